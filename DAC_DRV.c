@@ -266,6 +266,55 @@ int DAC_configDMA(int chn, DAC_dma_t dma)
 	return 0;
 }
 
+/**	@brief Configures the built-in wave generator of a channel.
+ *	@param chn The channel to configure. The value is either 1 or 2.
+ *	@param wave The wave to generate. The values for this parameter are
+ *	defined in DAC_wave_t.
+ *	@param bits The amplitude of the triangle, 2^bits - 1 codes, or the
+ *	number of unmasked LFSR bits of the noise. The value is 1 to 12.
+ *	@returns 0 if successful and -1 if otherwise.
+ *
+ *	@details The generator adds its value to the data holding register
+ *	on every trigger, which sets the offset. A trigger has to be
+ *	configured. The triangle counts up by one code per trigger and back
+ *	down, a period takes 2 * (2^bits - 1) triggers.
+ */
+int DAC_configWave(int chn, DAC_wave_t wave, int bits)
+{
+	uint32_t cr;
+	
+	if ((chn != 1) && (chn != 2))
+		return -1;
+	
+	if ((wave != DAC_WAVE_NONE) && ((bits < 1) || (bits > 12)))
+		return -1;
+	
+	switch (wave) {
+	case DAC_WAVE_NONE:
+		cr = 0;
+		break;
+	case DAC_WAVE_NOISE:
+		cr = DAC_CR_WAVE1_0 | ((uint32_t)(bits - 1) * DAC_CR_MAMP1_0);
+		break;
+	case DAC_WAVE_TRIANGLE:
+		cr = DAC_CR_WAVE1_1 | ((uint32_t)(bits - 1) * DAC_CR_MAMP1_0);
+		break;
+	default:
+		return -1;
+	}
+	
+	/* Channel 2 has the same bits 16 higher */
+	if (chn == 1) {
+		DAC->CR &= ~(DAC_CR_WAVE1 | DAC_CR_MAMP1);
+		DAC->CR |= cr;
+	} else {
+		DAC->CR &= ~(DAC_CR_WAVE2 | DAC_CR_MAMP2);
+		DAC->CR |= (cr << 16);
+	}
+	
+	return 0;
+}
+
 /**	@brief Initializes DAC.
  *	@param chn The channel to initialize. The value is either 1 or 2.
  *	@param conf Config structure for configuring the DAC.
@@ -33,6 +33,13 @@ typedef enum DAC_dma {
 	DAC_DMA_ENABLE,
 } DAC_dma_t;
 
+/** Enumeration for the built-in wave generators */
+typedef enum DAC_wave {
+	DAC_WAVE_NONE,
+	DAC_WAVE_NOISE,
+	DAC_WAVE_TRIANGLE
+} DAC_wave_t;
+
 /** Config structure for DAC */
 struct DAC_config {
 	DAC_trigger_t trig;
@@ -52,6 +59,7 @@ int DAC_enable(int chn);
 
 int DAC_configTrigger(int chn, DAC_trigger_t trig);
 int DAC_configDMA(int chn, DAC_dma_t dma);
+int DAC_configWave(int chn, DAC_wave_t wave, int bits);
 
 int DAC_init(int chn, struct DAC_config conf);
 
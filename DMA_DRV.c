@@ -7,6 +7,46 @@
  
 #include "DMA_DRV.h"
 
+/** Pointers to callback functions, indexed by channel number - 1 */
+void (*DMA_callbackFunction[7])(DMA_event_t event) = {NULL};
+
+/** @brief Converts an event to the channel interrupt enable bit.
+ *	@param event The event of interest.
+ *	@returns The CCR enable bit or 0 if the event is invalid.
+ */
+static uint32_t DMA_eventToEnableBit(DMA_event_t event)
+{
+	switch (event) {
+	case DMA_EVENT_HALF_TRANSFER:
+		return DMA_CCR_HTIE;
+	case DMA_EVENT_TRANSFER_COMPLETE:
+		return DMA_CCR_TCIE;
+	case DMA_EVENT_TRANSFER_ERROR:
+		return DMA_CCR_TEIE;
+	default:
+		return 0;
+	}
+}
+
+/** @brief Converts an event to the channel interrupt flag.
+ *	@param chn The DMA channel of interest.
+ *	@param event The event of interest.
+ *	@returns The ISR/IFCR bit or 0 if the event is invalid.
+ */
+static uint32_t DMA_eventToFlag(int chn, DMA_event_t event)
+{
+	switch (event) {
+	case DMA_EVENT_HALF_TRANSFER:
+		return DMA_ISR_HTIF1 << (4*(chn-1));
+	case DMA_EVENT_TRANSFER_COMPLETE:
+		return DMA_ISR_TCIF1 << (4*(chn-1));
+	case DMA_EVENT_TRANSFER_ERROR:
+		return DMA_ISR_TEIF1 << (4*(chn-1));
+	default:
+		return 0;
+	}
+}
+
 /** @brief Extracts the DMA channel base pointer.
  *	@param The channel of interest.
  *	@param dma The container to the Channel base pointer for
@@ -65,12 +105,106 @@ int DMA_enable(int chn)
 	return 0;
 }
 
+/** @brief Points an enabled channel at a new memory block.
+ *	@param chn The DMA channel to configure.
+ *	@param readMem The new memory address to read from.
+ *	@param numWrite The number of transfers in the new block.
+ *	@returns 0 if successful and -1 if otherwise.
+ *
+ *	@details The channel is briefly disabled since CMAR and CNDTR are
+ *	read only while it is enabled. In circular mode the new values are
+ *	also the ones reloaded at the end of every block. Call this from
+ *	the transfer complete callback to switch blocks without losing a
+ *	transfer.
+ */
+int DMA_setSource(int chn, const void *readMem, int numWrite)
+{
+	DMA_Channel_TypeDef *dma;
+	
+	if (DMA_extractBasePointer(chn, &dma))
+		return -1;
+	
+	dma->CCR &= ~(DMA_CCR_EN);
+	dma->CMAR = (uint32_t)(readMem);
+	dma->CNDTR = numWrite;
+	dma->CCR |= DMA_CCR_EN;
+	
+	return 0;
+}
+
+/** @brief Reads the number of transfers left in the current block.
+ *	@param chn The DMA channel to read.
+ *	@returns The value of CNDTR or -1 if the channel is invalid.
+ */
+int DMA_getRemaining(int chn)
+{
+	DMA_Channel_TypeDef *dma;
+	
+	if (DMA_extractBasePointer(chn, &dma))
+		return -1;
+	
+	return (int)(dma->CNDTR & 0x0000FFFF);
+}
+
+/** @brief Enables the interrupt of a channel event.
+ *	@param chn The DMA channel to configure.
+ *	@param event The event to enable.
+ *	@returns 0 if successful and -1 if otherwise.
+ *
+ *	@note Any stale flag of the event is cleared first so the callback
+ *	only runs on the next occurrence of the event.
+ */
+int DMA_enableInterrupt(int chn, DMA_event_t event)
+{
+	DMA_Channel_TypeDef *dma;
+	
+	if (DMA_extractBasePointer(chn, &dma))
+		return -1;
+	
+	if (!DMA_eventToEnableBit(event))
+		return -1;
+	
+	DMA1->IFCR = DMA_eventToFlag(chn, event);
+	dma->CCR |= DMA_eventToEnableBit(event);
+	
+	return 0;
+}
+
+/** @brief Disables the interrupt of a channel event.
+ *	@param chn The DMA channel to configure.
+ *	@param event The event to disable.
+ *	@returns 0 if successful and -1 if otherwise.
+ */
+int DMA_disableInterrupt(int chn, DMA_event_t event)
+{
+	DMA_Channel_TypeDef *dma;
+	
+	if (DMA_extractBasePointer(chn, &dma))
+		return -1;
+	
+	if (!DMA_eventToEnableBit(event))
+		return -1;
+	
+	dma->CCR &= ~(DMA_eventToEnableBit(event));
+	
+	return 0;
+}
+
 /** @brief Initializes the DMA
  *	@param chn The DMA channel to initialize
  *	@param conf The config structure for initializing the DMA channel.
+ *	@param callback Interrupt callback function.
  *	@returns 0 if successful and -1 if otherwise.
+ *
+ *	@details Memory and peripheral sizes may differ. A narrower memory
+ *	size is zero extended by the DMA when written to the peripheral.
+ *	A channel that is not circular stops after numWrite transfers until
+ *	it is given a new block with DMA_setSource. The callback replaces the
+ *	previous one even when NULL, and every event interrupt starts disabled
+ *	until DMA_enableInterrupt.
  */
-int DMA_init(int chn, struct DMA_config conf)
+int DMA_init(int chn, struct DMA_config conf,
+				void (*callback)(DMA_event_t event))
 {
 	DMA_Channel_TypeDef *dma;
 	
@@ -83,8 +217,110 @@ int DMA_init(int chn, struct DMA_config conf)
 	dma->CPAR = (uint32_t)(conf.writeMem);
 	dma->CNDTR = conf.numWrite;
 	
-	dma->CCR |=DMA_CCR_MINC | DMA_CCR_MSIZE_1 | DMA_CCR_PSIZE_1
-				| DMA_CCR_CIRC | DMA_CCR_DIR;
+	dma->CCR &= ~(DMA_CCR_MSIZE | DMA_CCR_PSIZE);
+	
+	switch (conf.memSize) {
+	case DMA_SIZE_8:
+		break;
+	case DMA_SIZE_16:
+		dma->CCR |= DMA_CCR_MSIZE_0;
+		break;
+	case DMA_SIZE_32:
+		dma->CCR |= DMA_CCR_MSIZE_1;
+		break;
+	default:
+		return -1;
+	}
+	
+	switch (conf.periphSize) {
+	case DMA_SIZE_8:
+		break;
+	case DMA_SIZE_16:
+		dma->CCR |= DMA_CCR_PSIZE_0;
+		break;
+	case DMA_SIZE_32:
+		dma->CCR |= DMA_CCR_PSIZE_1;
+		break;
+	default:
+		return -1;
+	}
+	
+	dma->CCR |=DMA_CCR_MINC | DMA_CCR_DIR;
+	
+	if (conf.circular)
+		dma->CCR |= DMA_CCR_CIRC;
+	else
+		dma->CCR &= ~(DMA_CCR_CIRC);
+	
+	/* A channel set up again must not keep the last user's handler */
+	DMA_callbackFunction[chn-1] = callback;
+	dma->CCR &= ~(DMA_CCR_HTIE | DMA_CCR_TCIE | DMA_CCR_TEIE);
+	
+	if ((conf.intEnable) && (callback != NULL)) {
+		if (chn == 1)
+			NVIC_EnableIRQ(DMA1_Channel1_IRQn);
+		else if (chn <= 3)
+			NVIC_EnableIRQ(DMA1_Channel2_3_IRQn);
+		else
+			NVIC_EnableIRQ(DMA1_Channel4_5_6_7_IRQn);
+	}
 	
 	return 0;
 }
+
+/** @brief Dispatches the pending events of a channel.
+ *	@param chn The DMA channel to service.
+ *	@details Only events with their interrupt enabled are passed to the
+ *	callback. The global flag of the channel is cleared before calling
+ *	the callback function.
+ */
+static void DMA_handleChannel(int chn)
+{
+	DMA_Channel_TypeDef *dma;
+	uint32_t isr;
+	
+	DMA_extractBasePointer(chn, &dma);
+	
+	isr = DMA1->ISR;
+	if (!(isr & (DMA_ISR_GIF1 << (4*(chn-1)))))
+		return;
+	
+	DMA1->IFCR = DMA_IFCR_CGIF1 << (4*(chn-1));
+	
+	if (DMA_callbackFunction[chn-1] == NULL)
+		return;
+	
+	if ((isr & DMA_eventToFlag(chn, DMA_EVENT_TRANSFER_ERROR)) &&
+			(dma->CCR & DMA_CCR_TEIE))
+		DMA_callbackFunction[chn-1](DMA_EVENT_TRANSFER_ERROR);
+	
+	if ((isr & DMA_eventToFlag(chn, DMA_EVENT_HALF_TRANSFER)) &&
+			(dma->CCR & DMA_CCR_HTIE))
+		DMA_callbackFunction[chn-1](DMA_EVENT_HALF_TRANSFER);
+	
+	if ((isr & DMA_eventToFlag(chn, DMA_EVENT_TRANSFER_COMPLETE)) &&
+			(dma->CCR & DMA_CCR_TCIE))
+		DMA_callbackFunction[chn-1](DMA_EVENT_TRANSFER_COMPLETE);
+}
+
+/** @brief IRQ Handler for DMA channel 1 */
+void DMA1_Channel1_IRQHandler(void)
+{
+	DMA_handleChannel(1);
+}
+
+/** @brief IRQ Handler for DMA channels 2 and 3 */
+void DMA1_Channel2_3_IRQHandler(void)
+{
+	DMA_handleChannel(2);
+	DMA_handleChannel(3);
+}
+
+/** @brief IRQ Handler for DMA channels 4 to 7 */
+void DMA1_Channel4_5_6_7_IRQHandler(void)
+{
+	DMA_handleChannel(4);
+	DMA_handleChannel(5);
+	DMA_handleChannel(6);
+	DMA_handleChannel(7);
+}
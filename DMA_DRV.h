@@ -8,18 +8,46 @@
 #ifndef DMA_DRV_H
 #define DMA_DRV_H
  
+#include <stddef.h>
+#include <stdbool.h>
 #include "stm32f0xx.h"
 
+/** Enumeration for DMA transfer sizes */
+typedef enum DMA_size {
+	DMA_SIZE_8,
+	DMA_SIZE_16,
+	DMA_SIZE_32
+} DMA_size_t;
+
+/** Enumeration for DMA channel events
+ *	@note Each event maps to one of the channel interrupt flags and is
+ *	passed to the callback function when its interrupt is enabled.
+ */
+typedef enum DMA_event {
+	DMA_EVENT_HALF_TRANSFER,
+	DMA_EVENT_TRANSFER_COMPLETE,
+	DMA_EVENT_TRANSFER_ERROR
+} DMA_event_t;
+
 /** Configuration structure for DMA setting up DMA */
 struct DMA_config {
 	int numWrite;
-	uint32_t *readMem;
+	const void *readMem;
 	uint32_t *writeMem;
+	DMA_size_t memSize;
+	DMA_size_t periphSize;
+	bool circular;
+	bool intEnable;
 };
 
 int DMA_extractBasePointer(int chn, DMA_Channel_TypeDef **dma);
 int DMA_disable(int chn);
 int DMA_enable(int chn);
-int DMA_init(int chn, struct DMA_config conf);
+int DMA_setSource(int chn, const void *readMem, int numWrite);
+int DMA_getRemaining(int chn);
+int DMA_enableInterrupt(int chn, DMA_event_t event);
+int DMA_disableInterrupt(int chn, DMA_event_t event);
+int DMA_init(int chn, struct DMA_config conf,
+				void (*callback)(DMA_event_t event));
 
 #endif	/* DMA_DRV_H */
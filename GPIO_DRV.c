@@ -7,6 +7,9 @@
  
 #include "GPIO_DRV.h"
 
+/** Pointers to callback functions, indexed by EXTI line */
+void (*GPIO_callbackFunction[16])(int pinNum) = {NULL};
+
 /** @brief Reads the input value of a GPIO pin.
  *	@param gpio Base pointer to the GPIO to be read.
  *	@param pinNum The pin number to the GPIO pin.
@@ -86,9 +89,25 @@ void GPIO_setDir(GPIO_TypeDef *gpio, int pinNum, GPIO_dir_t dir)
 		gpio->MODER	&= ~((3ul << 2*pinNum));
 		gpio->MODER |=	((1ul << 2*pinNum));
 		break;
+	case GPIO_DIR_ALTERNATE:
+		gpio->MODER	&= ~((3ul << 2*pinNum));
+		gpio->MODER |=	((2ul << 2*pinNum));
+		break;
 	}
 }
 
+/** @brief Selects the alternate function of a GPIO pin.
+ *	@param gpio The base pointer to the GPIO to configure.
+ *	@param pinNum The pin number of the GPIO pin to configure.
+ *	@param altFunc The alternate function number, AF0 to AF7. It only
+ *	takes effect with the direction set to GPIO_DIR_ALTERNATE.
+ */
+void GPIO_setAltFunc(GPIO_TypeDef *gpio, int pinNum, int altFunc)
+{
+	gpio->AFR[pinNum >> 3] &= ~((0xFul << 4*(pinNum & 7)));
+	gpio->AFR[pinNum >> 3] |=  (((uint32_t)(altFunc & 0xF) << 4*(pinNum & 7)));
+}
+
 /** @brief Sets the output type of a GPIO pin.
  *	@param gpio The base pointer to the GPIO to configure.
  *	@param pinNum the pin number of the GPIO pin to configure.
@@ -165,3 +184,140 @@ void GPIO_initPin(GPIO_TypeDef *gpio, int pinNum, struct GPIO_config conf)
 	GPIO_setSpeed(gpio, pinNum, conf.speed);
 	GPIO_setPullRes(gpio, pinNum, conf.pullRes);
 }
+
+/** @brief Converts a GPIO base pointer to its EXTICR port code.
+ *	@param gpio The base pointer to the GPIO of interest.
+ *	@returns The port code or -1 if the GPIO is invalid.
+ */
+static int GPIO_portCode(GPIO_TypeDef *gpio)
+{
+	if (gpio == GPIOA)
+		return 0;
+	else if (gpio == GPIOB)
+		return 1;
+	else if (gpio == GPIOC)
+		return 2;
+	else if (gpio == GPIOD)
+		return 3;
+	else if (gpio == GPIOE)
+		return 4;
+	else if (gpio == GPIOF)
+		return 5;
+	
+	return -1;
+}
+
+/** @brief Enables the external interrupt of a GPIO pin.
+ *	@param gpio The base pointer to the GPIO of interest.
+ *	@param pinNum The pin number of the GPIO pin of interest.
+ *	@param edge The edge that raises the interrupt. The values for this
+ *	parameter are defined in GPIO_edge_t.
+ *	@param callback Interrupt callback function, called with pinNum.
+ *	@returns 0 if successful and -1 if otherwise.
+ *
+ *	@details Each EXTI line serves the pin of the same number on one
+ *	port only, enabling it for another port moves the line over. The
+ *	pin should already be set up as an input with GPIO_initPin.
+ */
+int GPIO_enableInterrupt(GPIO_TypeDef *gpio, int pinNum, GPIO_edge_t edge,
+				void (*callback)(int pinNum))
+{
+	int port;
+	
+	port = GPIO_portCode(gpio);
+	if ((port < 0) || (pinNum < 0) || (pinNum > 15) || (callback == NULL))
+		return -1;
+	
+	RCC->APB2ENR |= RCC_APB2ENR_SYSCFGCOMPEN; /* EXTICR lives in SYSCFG */
+	
+	SYSCFG->EXTICR[pinNum >> 2] &= ~((0xFul << 4*(pinNum & 3)));
+	SYSCFG->EXTICR[pinNum >> 2] |=  (((uint32_t)port << 4*(pinNum & 3)));
+	
+	switch (edge) {
+	case GPIO_EDGE_RISING:
+		EXTI->RTSR |=  ((1ul << pinNum));
+		EXTI->FTSR &= ~((1ul << pinNum));
+		break;
+	case GPIO_EDGE_FALLING:
+		EXTI->RTSR &= ~((1ul << pinNum));
+		EXTI->FTSR |=  ((1ul << pinNum));
+		break;
+	case GPIO_EDGE_BOTH:
+		EXTI->RTSR |=  ((1ul << pinNum));
+		EXTI->FTSR |=  ((1ul << pinNum));
+		break;
+	default:
+		return -1;
+	}
+	
+	GPIO_callbackFunction[pinNum] = callback;
+	
+	EXTI->PR = (1ul << pinNum); /* Clear a stale pending edge */
+	EXTI->IMR |= (1ul << pinNum);
+	
+	if (pinNum <= 1)
+		NVIC_EnableIRQ(EXTI0_1_IRQn);
+	else if (pinNum <= 3)
+		NVIC_EnableIRQ(EXTI2_3_IRQn);
+	else
+		NVIC_EnableIRQ(EXTI4_15_IRQn);
+	
+	return 0;
+}
+
+/** @brief Disables the external interrupt of a GPIO pin.
+ *	@param pinNum The EXTI line, which is the pin number of the pin.
+ *	@returns 0 if successful and -1 if otherwise.
+ */
+int GPIO_disableInterrupt(int pinNum)
+{
+	if ((pinNum < 0) || (pinNum > 15))
+		return -1;
+	
+	EXTI->IMR &= ~((1ul << pinNum));
+	GPIO_callbackFunction[pinNum] = NULL;
+	
+	return 0;
+}
+
+/** @brief Dispatches the pending EXTI lines of a range.
+ *	@param first The first line to service.
+ *	@param last The last line to service.
+ *	@details The pending flag of a line is cleared before calling its
+ *	callback function.
+ */
+static void GPIO_handleLines(int first, int last)
+{
+	uint32_t pending;
+	int line;
+	
+	pending = EXTI->PR & EXTI->IMR;
+	
+	for (line = first; line <= last; line++) {
+		if (!(pending & (1ul << line)))
+			continue;
+		
+		EXTI->PR = (1ul << line);
+		
+		if (GPIO_callbackFunction[line] != NULL)
+			GPIO_callbackFunction[line](line);
+	}
+}
+
+/** @brief IRQ Handler for EXTI lines 0 and 1 */
+void EXTI0_1_IRQHandler(void)
+{
+	GPIO_handleLines(0, 1);
+}
+
+/** @brief IRQ Handler for EXTI lines 2 and 3 */
+void EXTI2_3_IRQHandler(void)
+{
+	GPIO_handleLines(2, 3);
+}
+
+/** @brief IRQ Handler for EXTI lines 4 to 15 */
+void EXTI4_15_IRQHandler(void)
+{
+	GPIO_handleLines(4, 15);
+}
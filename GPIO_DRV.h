@@ -8,6 +8,7 @@
 #ifndef GPIO_DRV_H
 #define GPIO_DRV_H
 
+#include <stddef.h>
 #include "stm32f0xx.h"
 
 /** Enumearation for GPIO logic levels */
@@ -19,7 +20,8 @@ typedef enum GPIO_outVal {
 /** Enumeration for GPIO direction configurations. */
 typedef enum GPIO_dir {
 	GPIO_DIR_INPUT,
-	GPIO_DIR_OUTPUT
+	GPIO_DIR_OUTPUT,
+	GPIO_DIR_ALTERNATE
 } GPIO_dir_t;
 
 /** Enumeration for GPIO output type configurations. */
@@ -42,6 +44,13 @@ typedef enum GPIO_pullRes {
 	GPIO_PULLRES_PULLDOWN
 } GPIO_pullRes_t;
 
+/** Enumeration for GPIO external interrupt edges */
+typedef enum GPIO_edge {
+	GPIO_EDGE_RISING,
+	GPIO_EDGE_FALLING,
+	GPIO_EDGE_BOTH
+} GPIO_edge_t;
+
 /** Configuration structure used for pin initialization */
 struct GPIO_config {
 	GPIO_dir_t dir;
@@ -60,7 +69,12 @@ void GPIO_setDir(GPIO_TypeDef *gpio, int pinNum, GPIO_dir_t dir);
 void GPIO_setOutType(GPIO_TypeDef *gpio, int pinNum, GPIO_outType_t type);
 void GPIO_setSpeed(GPIO_TypeDef *gpio, int pinNum, GPIO_speed_t speed);
 void GPIO_setPullRes(GPIO_TypeDef *gpio, int pinNum, GPIO_pullRes_t res);
+void GPIO_setAltFunc(GPIO_TypeDef *gpio, int pinNum, int altFunc);
 
 void GPIO_initPin(GPIO_TypeDef *gpio, int pinNum, struct GPIO_config conf);
 
+int GPIO_enableInterrupt(GPIO_TypeDef *gpio, int pinNum, GPIO_edge_t edge,
+				void (*callback)(int pinNum));
+int GPIO_disableInterrupt(int pinNum);
+
 #endif	/* GPIO_DRV_H */
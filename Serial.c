@@ -32,9 +32,6 @@
 #define __DIVFRAQ(__PCLK, __BAUD)   (((__DIV(__PCLK, __BAUD) - (__DIVMANT(__PCLK, __BAUD) * 100)) * 16 + 50) / 100)
 #define __USART_BRR(__PCLK, __BAUD) ((__DIVMANT(__PCLK, __BAUD) << 4)|(__DIVFRAQ(__PCLK, __BAUD) & 0x0F))
 
-/** Ring buffer size */
-#define SER_RBUF_SIZE	500
-
 /** The structure for a ring buffer */
 struct SER_ringBuf {
 	unsigned char buffer[SER_RBUF_SIZE];
@@ -119,7 +116,7 @@ void SER_Initialize (void) {
 
   NVIC_EnableIRQ(USART2_IRQn);
 
-  USARTx->BRR  = __USART_BRR(48000000ul, 115200ul);  /* 115200 baud @ 48MHz   */
+  USARTx->BRR  = __USART_BRR(48000000ul, SER_BAUDRATE);  /* 115200 baud @ 48MHz */
   USARTx->CR3   = 0x0000;                  /* no flow control                 */
   USARTx->CR2   = 0x0000;                  /* 1 stop bit                      */
   USARTx->CR1   = ((   1ul <<  2) |        /* enable RX                       */
@@ -156,6 +153,32 @@ int SER_GetChar_nonBlocking(unsigned char *output)
 	return (rx_rbuf_read(output));
 }
 
+/** @brief Reads up to len bytes from the rx ring buffer.
+ *	@param output The container for the bytes read.
+ *	@param len The maximum number of bytes to read.
+ *	@returns The number of bytes read.
+ */
+int SER_Read(unsigned char *output, int len)
+{
+	int i;
+
+	for (i = 0; i < len; i++) {
+		if (rx_rbuf_read(&output[i]))
+			break;
+	}
+
+	return i;
+}
+
+/** @brief Returns the number of bytes waiting in the rx ring buffer.
+ */
+int SER_Available(void)
+{
+	int head = rx_rbuf.head;
+
+	return (head - rx_rbuf.tail + SER_RBUF_SIZE) % SER_RBUF_SIZE;
+}
+
 /** @brief Function for handling rx interrupts.
  */
 static void SER_handleRxInterrupt(void)
@@ -16,9 +16,17 @@
 #ifndef SERIAL_H
 #define SERIAL_H
 
+/** Line rate of USART2 */
+#define SER_BAUDRATE	115200ul
+
+/** Ring buffer size */
+#define SER_RBUF_SIZE	500
+
 extern void SER_Initialize(void);
 extern unsigned char SER_GetChar (void);
 int SER_GetChar_nonBlocking(unsigned char *output);
+int SER_Read(unsigned char *output, int len);
+int SER_Available(void);
 extern unsigned char SER_PutChar(unsigned char ch);
 
 #endif
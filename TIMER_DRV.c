@@ -2,8 +2,9 @@
 /** @file TIMER_DRV.c
  *  @brief TIMER Driver for the STM32F072RB.
  *
- *	@details The current Timer driver only supports the basic timers of the
- *	STM32F072RB. The timers which are supported are TIMER 6 and TIMER 7.
+ *	@details The current Timer driver mainly supports the basic timers of
+ *	the STM32F072RB, TIMER 6 and TIMER 7. TIMER 2, 3 and 15 are supported
+ *	as PWM outputs on channel 1 only.
  *
  *  @author Dennis Law
  *  @date April 2016
@@ -15,6 +16,15 @@
 void (*TIMER6_callbackFunction)(void) = NULL;
 void (*TIMER7_callbackFunction)(void) = NULL;
 
+/** @brief Checks for a timer supported as a PWM output.
+ *	@param tim Base pointer of the timer to check.
+ *	@returns 1 for TIM2, TIM3 or TIM15 and 0 if otherwise.
+ */
+static int TIMER_isPWM(TIM_TypeDef *tim)
+{
+	return ((tim == TIM2) || (tim == TIM3) || (tim == TIM15));
+}
+
 /** @brief Generates an event for the selected timer.
  *	@param tim Base pointer for the selected timer. The value for
  *	this parameter can be either TIM6 or TIM7.
@@ -30,28 +40,28 @@ int TIMER_generateEvent(TIM_TypeDef *tim)
 	return 0;
 }
 
-/** @brief Disable the counting of a basic timer.
+/** @brief Disable the counting of a timer.
  *	@param tim Base pointer to the timer to be configured. The value
- *	for this argument can either be TIM6 or TIM7.
+ *	for this argument can be TIM6, TIM7 or a PWM timer.
  *	@returns 0 if successful and -1 if otherwise.
  */
 int TIMER_disable(TIM_TypeDef *tim)
 {
-	if ((tim != TIM6) && (tim != TIM7))
+	if ((tim != TIM6) && (tim != TIM7) && !TIMER_isPWM(tim))
 		return -1;
 
 	tim->CR1 &= ~(TIM_CR1_CEN);
 	return 0;
 }
 
-/** @brief Enables the counting of a basic timer.
+/** @brief Enables the counting of a timer.
  *	@param tim Base pointer to the timer to be configured. The value
- *	for this argument can either be TIM6 or TIM7.
+ *	for this argument can be TIM6, TIM7 or a PWM timer.
  *	@returns 0 if successful and -1 if otherwise.
  */
 int TIMER_enable(TIM_TypeDef *tim)
 {
-	if ((tim != TIM6) && (tim != TIM7))
+	if ((tim != TIM6) && (tim != TIM7) && !TIMER_isPWM(tim))
 		return -1;
 
 	tim->CR1 |= TIM_CR1_CEN;
@@ -167,9 +177,42 @@ int TIMER_setUGInterrupt(TIM_TypeDef *tim, TIMER_UGInterrupt_t UGInt)
 	return 0;
 }
 
-/** @brief Enables the clock for a basic timer peripheral.
+/** @brief Enables the update interrupt of a basic timer.
+ *	@param tim Base pointer for the basic timer to configure. The value
+ *	for this argument can be either TIM6 or TIM7.
+ *	@returns 0 if successful and -1 if otherwise.
+ *
+ *	@note Any stale update flag is cleared first so the callback only
+ *	runs on the next update event. The callback has to be registered
+ *	with TIMER_init.
+ */
+int TIMER_enableInterrupt(TIM_TypeDef *tim)
+{
+	if ((tim != TIM6) && (tim != TIM7))
+		return -1;
+
+	tim->SR &= ~(TIM_SR_UIF);
+	tim->DIER |= TIM_DIER_UIE;
+	return 0;
+}
+
+/** @brief Disables the update interrupt of a basic timer.
+ *	@param tim Base pointer for the basic timer to configure. The value
+ *	for this argument can be either TIM6 or TIM7.
+ *	@returns 0 if successful and -1 if otherwise.
+ */
+int TIMER_disableInterrupt(TIM_TypeDef *tim)
+{
+	if ((tim != TIM6) && (tim != TIM7))
+		return -1;
+
+	tim->DIER &= ~(TIM_DIER_UIE);
+	return 0;
+}
+
+/** @brief Enables the clock for a timer peripheral.
  *	@param tim Base pointer to the timer to be configured. The value
- *	for this argument can either be TIM6 or TIM7.
+ *	for this argument can be TIM6, TIM7 or a PWM timer.
  *	@returns 0 if sucessful and -1 if otherwise.
  */
 int TIMER_enableClock(TIM_TypeDef *tim)
@@ -178,6 +221,12 @@ int TIMER_enableClock(TIM_TypeDef *tim)
 		RCC->APB1ENR |= RCC_APB1ENR_TIM6EN;
 	else if (tim == TIM7)
 		RCC->APB1ENR |= RCC_APB1ENR_TIM7EN;
+	else if (tim == TIM2)
+		RCC->APB1ENR |= RCC_APB1ENR_TIM2EN;
+	else if (tim == TIM3)
+		RCC->APB1ENR |= RCC_APB1ENR_TIM3EN;
+	else if (tim == TIM15)
+		RCC->APB2ENR |= RCC_APB2ENR_TIM15EN;
 	else
 		return -1;
 
@@ -210,8 +259,12 @@ int TIMER_init(TIM_TypeDef *tim, struct TIMER_config conf,
 	
 	tim->DIER |= TIM_DIER_UDE;
 	
-	tim->SR &= ~(TIM_SR_UIF); /* Clear interrupt flag */
-	tim->DIER |= TIM_DIER_UIE; /* Enable interrupt */
+	/* The update interrupt is only enabled with a callback, the IRQ
+	 * may still be enabled from an earlier initialization */
+	if ((conf.intEnable) && (callback != NULL))
+		TIMER_enableInterrupt(tim);
+	else
+		TIMER_disableInterrupt(tim);
 
 	if ((tim == TIM6) && (conf.intEnable)) {
 		if (callback != NULL) {
@@ -228,6 +281,59 @@ int TIMER_init(TIM_TypeDef *tim, struct TIMER_config conf,
 	return 0;
 }
 
+/** @brief Initializes PWM on channel 1 of a general purpose timer.
+ *	@param tim Base pointer of the timer to initialize. The value for
+ *	this argument can be TIM2, TIM3 or TIM15.
+ *	@param conf Reload, prescaler and compare values of the output.
+ *	@returns 0 if successful and -1 if otherwise.
+ *
+ *	@details The period is (count+1)*(prescale+1) timer clocks. The
+ *	values are loaded straight away but the counter is left stopped,
+ *	call TIMER_enable to start the output. The pin has to be set to
+ *	the alternate function of the channel.
+ */
+int TIMER_initPWM(TIM_TypeDef *tim, struct TIMER_pwmConfig conf)
+{
+	if (!TIMER_isPWM(tim))
+		return -1;
+
+	TIMER_enableClock(tim);
+
+	tim->CR1 = TIM_CR1_ARPE; /* ARR register is buffered */
+	tim->CCMR1 &= ~(TIM_CCMR1_OC1M);
+	tim->CCMR1 |= TIM_CCMR1_OC1M_2 | TIM_CCMR1_OC1M_1 | TIM_CCMR1_OC1PE;
+	tim->CCER |= TIM_CCER_CC1E;
+
+	if (tim == TIM15)
+		tim->BDTR |= TIM_BDTR_MOE; /* Outputs of TIM15 are gated */
+
+	TIMER_setPWM(tim, conf);
+	tim->EGR = TIM_EGR_UG; /* Load the buffered values */
+
+	return 0;
+}
+
+/** @brief Changes the PWM of a general purpose timer.
+ *	@param tim Base pointer of the timer to configure. The value for
+ *	this argument can be TIM2, TIM3 or TIM15.
+ *	@param conf Reload, prescaler and compare values of the output.
+ *	@returns 0 if successful and -1 if otherwise.
+ *
+ *	@details All three values are buffered and take effect together at
+ *	the end of the running period, the output does not glitch.
+ */
+int TIMER_setPWM(TIM_TypeDef *tim, struct TIMER_pwmConfig conf)
+{
+	if (!TIMER_isPWM(tim))
+		return -1;
+
+	tim->PSC = conf.prescale;
+	tim->ARR = conf.count;
+	tim->CCR1 = conf.compare;
+
+	return 0;
+}
+
 /** @brief IRQ Handler for Timer 6
  *	@details The interrupt flag for Timer 6 will be cleared before calling
  *	the callback function.
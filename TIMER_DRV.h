@@ -44,6 +44,15 @@ struct TIMER_config {
 	bool intEnable;
 };
 
+/** Configuration parameters for PWM on channel 1 of a general purpose
+ *	timer. The output is high while the counter is below compare.
+ */
+struct TIMER_pwmConfig {
+	uint16_t count;
+	uint16_t prescale;
+	uint16_t compare;
+};
+
 int TIMER_generateEvent(TIM_TypeDef *tim);
 int TIMER_disable(TIM_TypeDef *tim);
 int TIMER_enable(TIM_TypeDef *tim);
@@ -53,9 +62,14 @@ int TIMER_setMasterMode(TIM_TypeDef *tim, TIMER_masterMode_t mmode);
 int TIMER_setCount(TIM_TypeDef *tim, int16_t val);
 int TIMER_setPrescaler(TIM_TypeDef *tim, int16_t val);
 int TIMER_setUGInterrupt(TIM_TypeDef *tim, TIMER_UGInterrupt_t UGInt);
+int TIMER_enableInterrupt(TIM_TypeDef *tim);
+int TIMER_disableInterrupt(TIM_TypeDef *tim);
 int TIMER_enableClock(TIM_TypeDef *tim);
 
 int TIMER_init(TIM_TypeDef *tim, struct TIMER_config conf,
 				void (*callback)(void));
 
+int TIMER_initPWM(TIM_TypeDef *tim, struct TIMER_pwmConfig conf);
+int TIMER_setPWM(TIM_TypeDef *tim, struct TIMER_pwmConfig conf);
+
 #endif	/* TIMER_DRV_H */
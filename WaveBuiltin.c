@@ -0,0 +1,111 @@
+#include "WaveGenPriv.h"
+
+
+/* Triangle and noise from the wave generators built into the DAC. TIM6
+ * triggers the DAC and the DAC steps its own triangle counter or LFSR,
+ * there is no table, no DMA and no interrupt, so DMA_CHN stays free.
+ *
+ * The generators span 2^bits-1 codes, the amplitude is rounded down to
+ * the nearest of those. The triangle moves one code per trigger, so a
+ * full scale one needs 8190 triggers per cycle and tops out near 120 Hz
+ * at DAC_FAST_SAMPLE_WAIT_TIME_NS. Smaller amplitudes go faster. For
+ * noise the frequency is the rate new values come out at. Channel 1
+ * only. */
+
+static uint8_t BuiltinRunning;
+
+static uint32_t Builtin_Bits(float amplitude)
+{
+	uint32_t code;
+	uint32_t bits;
+
+	code = AmplitudeToResolution(amplitude);
+	bits = 1;
+	while(bits<12&&(2u<<bits)-1<=code)
+		bits++;
+
+	return bits;
+}
+
+static uint32_t Builtin_Triggers(enum WAVEGEN_BUILTIN_WAVES wave, uint32_t bits)
+{
+	if(wave==WAVEGEN_BUILTIN_TRIANGLE)
+		return 2*((1u<<bits)-1);
+	return 1;
+}
+
+/* Starts the wave at frequency_mhz, stopping whatever was playing.
+ * Returns the frequency produced in millihertz, 0 if it is out of reach
+ * for the amplitude. */
+uint32_t StartBuiltinWave(enum WAVEGEN_BUILTIN_WAVES wave, uint32_t frequency_mhz, float amplitude)
+{
+	struct DAC_config dacConf;
+	struct TIMER_config timConf;
+	uint32_t bits;
+	uint32_t triggers;
+	uint64_t ticks;
+	uint32_t prescale;
+	uint32_t count;
+
+	StopOutput();
+
+	if(amplitude>MAX_AMPLITUDE_FLOAT||amplitude<MIN_AMPLITUDE_FLOAT||frequency_mhz==0||
+		frequency_mhz>GetBuiltinMaxFreq(wave,amplitude)*1000ull)
+		return 0;
+
+	bits = Builtin_Bits(amplitude);
+	triggers = Builtin_Triggers(wave,bits);
+
+	ticks = ((uint64_t)SystemCoreClock*1000+(uint64_t)frequency_mhz*triggers/2)/((uint64_t)frequency_mhz*triggers);
+	prescale = (uint32_t)((ticks-1)>>16);
+	if(prescale>0xFFFF)
+		return 0;
+	count = (uint32_t)((ticks+(prescale+1)/2)/(prescale+1));
+
+	TIMER_disable(TIM6);
+	DAC_disable(DAC_CHN);
+	DAC_disable(DAC_CHN2);
+
+	//the generator counts up from the data register
+	dacConf.dma = DAC_DMA_DISABLE;
+	dacConf.trig = DAC_TRIGGER_TIMER6;
+
+	DAC_init(DAC_CHN, dacConf);
+	DAC_writeSingle(DAC_CHN, 0, DAC_RESOLUTION_12);
+	DAC_configWave(DAC_CHN, (wave==WAVEGEN_BUILTIN_TRIANGLE)?DAC_WAVE_TRIANGLE:DAC_WAVE_NOISE, bits);
+	DAC_enable(DAC_CHN);
+
+	timConf.count = count-1;
+	timConf.prescale = prescale;
+	timConf.mode = TIMER_MODE_CONTINUOUS;
+	timConf.mmode = TIMER_MASTERMODE_UPDATE;
+	timConf.UGInt = TIMER_UGINTERRUPT_DISABLE;
+	timConf.intEnable = false;
+
+	TIMER_init(TIM6, timConf, NULL);
+	TIMER_enable(TIM6);
+
+	BuiltinRunning = 1;
+	return (uint32_t)(((uint64_t)SystemCoreClock*1000+(uint64_t)triggers*count*(prescale+1)/2)/
+		((uint64_t)triggers*count*(prescale+1)));
+}
+
+void StopBuiltinWave(void)
+{
+	if(!BuiltinRunning)
+		return;
+
+	TIMER_disable(TIM6);
+	DAC_configWave(DAC_CHN, DAC_WAVE_NONE, 0);
+	//leave channel 1 off and untriggered at 0, as the next engine expects
+	DAC_configTrigger(DAC_CHN, DAC_TRIGGER_NONE);
+	DAC_writeSingle(DAC_CHN, 0, DAC_RESOLUTION_12);
+	DAC_disable(DAC_CHN);
+	BuiltinRunning = 0;
+}
+
+/* Highest frequency of the wave at the amplitude, in hertz */
+uint32_t GetBuiltinMaxFreq(enum WAVEGEN_BUILTIN_WAVES wave, float amplitude)
+{
+	return 1000000000/(DAC_FAST_SAMPLE_WAIT_TIME_NS*Builtin_Triggers(wave,Builtin_Bits(amplitude)));
+}
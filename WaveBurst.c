@@ -0,0 +1,233 @@
+#include "WaveGenPriv.h"
+#include "GPIO_DRV.h"
+
+
+/* Triggered bursts of a whole number of cycles. TIM6 clocks the DAC as in
+ * the table engine but waits for a trigger, and the DMA is not circular:
+ * each transfer complete interrupt hands it the next block of the table
+ * until cycles*N samples have been sent. The last block puts TIM6 into one
+ * pulse mode, so the timer stops itself on the update that outputs the
+ * final sample and the output rests on the first table sample.
+ *
+ * Between bursts the DAC holds table[0] and its data register already
+ * has table[1], so a trigger only has to start TIM6. Its counter waits at
+ * the reload value and the first update follows one prescaled tick later.
+ * From the trigger edge that is the EXTI interrupt entry and dispatch,
+ * around 60 core clocks or 1.3 us at 48 MHz, plus prescale+1 clocks. The
+ * jitter is that of the interrupt entry, the DMA interrupts of a running
+ * burst do not delay the samples. Channel 1 only. */
+
+enum BURST_STATES
+{
+	BURST_IDLE=0,
+	BURST_ARMED,
+	BURST_RUNNING
+};
+
+static volatile enum BURST_STATES BurstState;
+static const sample_t* BurstTable;
+static uint32_t BurstNoOfSample;
+static uint32_t BurstCycles;
+static enum WAVEGEN_TRIGGERS BurstTrigger;
+
+//next table index for the DMA and samples still to hand it
+static uint32_t BurstIndex;
+static uint32_t BurstLeft;
+static volatile uint32_t BurstCount;
+
+static void Burst_NextBlock(void)
+{
+	uint32_t count;
+
+	count = BurstNoOfSample-BurstIndex;
+	if(count>BurstLeft)
+		count = BurstLeft;
+
+	DMA_setSource(DMA_CHN,&BurstTable[BurstIndex],count);
+	BurstLeft -= count;
+	BurstIndex = 0;
+}
+
+static void Burst_Refill(DMA_event_t event)
+{
+	if(event!=DMA_EVENT_TRANSFER_COMPLETE)
+		return;
+
+	if(BurstLeft)
+	{
+		Burst_NextBlock();
+	}
+	else
+	{
+		//the last sample is in the data register, one more update sends it
+		TIMER_setMode(TIM6, TIMER_MODE_ONEPULSE);
+		TIMER_enableInterrupt(TIM6);
+	}
+}
+
+/* table[0] is on the output and the next trigger sends table[1] first,
+ * the DMA carries on from table[2] */
+static void Burst_Load(void)
+{
+	//drops the DMA request of the update that ended the last burst
+	DAC_configDMA(DAC_CHN, DAC_DMA_DISABLE);
+	SAMPLE_DAC_REGISTER = BurstTable[1];
+	DAC_configDMA(DAC_CHN, DAC_DMA_ENABLE);
+
+	BurstIndex = 2%BurstNoOfSample;
+	BurstLeft = BurstCycles*BurstNoOfSample-1;
+	Burst_NextBlock();
+
+	TIMER_setMode(TIM6, TIMER_MODE_CONTINUOUS);
+	TIM6->CNT = TIM6->ARR;
+	BurstState = BURST_ARMED;
+}
+
+/* TIM6 stopped after the final sample */
+static void Burst_Done(void)
+{
+	TIMER_disableInterrupt(TIM6);
+	BurstCount++;
+	Burst_Load();
+}
+
+static void Burst_Edge(int pinNum)
+{
+	(void)pinNum;
+	TriggerBurst();
+}
+
+/* Starts an armed burst, a trigger while one is running is ignored */
+void TriggerBurst(void)
+{
+	if(BurstState!=BURST_ARMED)
+		return;
+
+	TIMER_enable(TIM6);
+	BurstState = BURST_RUNNING;
+}
+
+/* Arms a burst of cycles whole cycles that starts on every trigger, the
+ * output rests on the start of the cycle in between. TriggerBurst always
+ * starts it, the edge triggers also come from BURST_TRIGGER_PIN. Stops
+ * whatever was playing. Returns 0 if the parameters are out of range. */
+uint8_t ArmBurst(enum WAVEFORM_TYPES waveform_types, uint32_t frequency, float amplitude, uint32_t cycles, enum WAVEGEN_TRIGGERS trigger)
+{
+	struct DAC_config dacConf;
+	struct DMA_config dmaConf;
+	struct TIMER_config timConf;
+	struct GPIO_config gpioConf;
+	struct WAVEFORM_TIMING timing;
+	const sample_t* pTable;
+	uint32_t noofsample;
+
+	StopOutput();
+
+	//the DMA is handed a block per cycle, which needs the normal DAC rate
+	if(!IsParameterAllowed(waveform_types,frequency,amplitude)||frequency>MAX_FREQUENCY||
+		cycles==0||cycles>BURST_MAX_CYCLES)
+		return 0;
+
+	switch(waveform_types)
+	{
+		case WAVEFORM_TYPE_SQUARE:
+			noofsample = 2;
+		break;
+		default:
+			noofsample = 1000000000/(frequency*DAC_SAMPLE_WAIT_TIME_NS);
+			if(noofsample>MAX_MEMORY_ALLOWED)
+				noofsample = MAX_MEMORY_ALLOWED;
+			if(waveform_types==WAVEFORM_TYPE_ARBITRARY&&GetUploadLength()<=noofsample)
+				noofsample = GetUploadLength();
+		break;
+	}
+	if(noofsample<2||!SolveTiming(frequency*1000,noofsample,noofsample,0,&timing))
+		return 0;
+
+	pTable = Cache_GetTable(waveform_types,noofsample,AmplitudeToResolution(amplitude));
+	if(pTable==NULL)
+		return 0;
+	Cache_Lock(pTable);
+
+	BurstTable = pTable;
+	BurstNoOfSample = noofsample;
+	BurstCycles = cycles;
+	BurstTrigger = trigger;
+	BurstCount = 0;
+
+	TIMER_disable(TIM6);
+	DMA_disable(DMA_CHN);
+	DAC_disable(DAC_CHN);
+	DAC_disable(DAC_CHN2);
+
+	//loads the prescaler before the DAC listens to TIM6
+	timConf.count = timing.timerCount;
+	timConf.prescale = timing.timerPrescale;
+	timConf.mode = TIMER_MODE_CONTINUOUS;
+	timConf.mmode = TIMER_MASTERMODE_UPDATE;
+	timConf.UGInt = TIMER_UGINTERRUPT_DISABLE;
+	timConf.intEnable = true;
+
+	TIMER_init(TIM6, timConf, &Burst_Done);
+	TIMER_disableInterrupt(TIM6);
+	TIMER_generateEvent(TIM6);
+
+	//table[0] goes straight to the output
+	dacConf.dma = DAC_DMA_DISABLE;
+	dacConf.trig = DAC_TRIGGER_SOFTWARE;
+
+	DAC_init(DAC_CHN, dacConf);
+	DAC_enable(DAC_CHN);
+	SAMPLE_DAC_REGISTER = pTable[0];
+	DAC_setSoftwareTriggerSingle(DAC_CHN);
+	DAC_configTrigger(DAC_CHN, DAC_TRIGGER_TIMER6);
+
+	dmaConf.numWrite = noofsample;
+	dmaConf.readMem = pTable;
+	dmaConf.writeMem = (uint32_t *)(&SAMPLE_DAC_REGISTER);
+	dmaConf.memSize = SAMPLE_DMA_SIZE;
+	dmaConf.periphSize = DMA_SIZE_32;
+	dmaConf.circular = false;
+	dmaConf.intEnable = true;
+
+	DMA_init(DMA_CHN, dmaConf, &Burst_Refill);
+	DMA_enableInterrupt(DMA_CHN, DMA_EVENT_TRANSFER_COMPLETE);
+
+	Burst_Load();
+
+	if(trigger!=WAVEGEN_TRIGGER_SOFTWARE)
+	{
+		gpioConf.dir = GPIO_DIR_INPUT;
+		gpioConf.outType = GPIO_OUTTYPE_PUSHPULL;
+		gpioConf.speed = GPIO_SPEED_FAST;
+		gpioConf.pullRes = (trigger==WAVEGEN_TRIGGER_RISING)?GPIO_PULLRES_PULLDOWN:GPIO_PULLRES_PULLUP;
+
+		GPIO_initPin(BURST_TRIGGER_PORT, BURST_TRIGGER_PIN, gpioConf);
+		GPIO_enableInterrupt(BURST_TRIGGER_PORT, BURST_TRIGGER_PIN,
+			(trigger==WAVEGEN_TRIGGER_RISING)?GPIO_EDGE_RISING:GPIO_EDGE_FALLING, &Burst_Edge);
+	}
+
+	return 1;
+}
+
+void StopBurst(void)
+{
+	if(BurstState==BURST_IDLE)
+		return;
+
+	if(BurstTrigger!=WAVEGEN_TRIGGER_SOFTWARE)
+		GPIO_disableInterrupt(BURST_TRIGGER_PIN);
+	TIMER_disable(TIM6);
+	TIMER_disableInterrupt(TIM6);
+	DMA_disableInterrupt(DMA_CHN, DMA_EVENT_TRANSFER_COMPLETE);
+	DMA_disable(DMA_CHN);
+	Cache_Unlock(BurstTable);
+	BurstTable = NULL;
+	BurstState = BURST_IDLE;
+}
+
+/* Bursts completed since ArmBurst */
+uint32_t GetBurstCount(void)
+{
+	return BurstCount;
+}
@@ -0,0 +1,494 @@
+#include "WaveGenPriv.h"
+#include "Serial.h"
+
+
+/* LRU cache of generated tables keyed by waveform type, sample count and
+ * amplitude code. The DMA plays straight out of the cache, so recalling a
+ * cached table only moves the DMA source. Tables being played are locked
+ * and never evicted.
+ *
+ * The pool is split into two banks of at least MAX_MEMORY_ALLOWED samples
+ * and a table never straddles them. With one table locked the other bank
+ * can always be emptied, so a full size table always finds room.
+ *
+ * A miss whose shape and length are already cached at another amplitude
+ * is rescaled from that table instead of being generated again. Only
+ * generated tables at no less than half the new amplitude are used as a
+ * source, which keeps rescaled tables within 2 LSB of generated ones.
+ *
+ * The standard full scale tables in WaveTables.c sit in front of the pool.
+ * They are played straight from flash and are the preferred scale source
+ * for their shape and length at any other amplitude.
+ *
+ * Engines that need working memory of their own for as long as they play
+ * borrow it from the pool with Cache_Borrow. A borrowed block is a locked
+ * entry that never matches a table and goes with its last unlock, so it
+ * takes the room of a table only while it is in use.
+ *
+ * The sequencer gets its tables from PendSV, which may interrupt a cache
+ * call of the main context. It only gets in through Cache_TryEnter while
+ * the cache is idle, otherwise PendSV is pended again once the main
+ * context leaves. No other interrupt uses the cache. */
+
+#define CACHE_SAMPLES		(WAVEGEN_CACHE_BYTES/sizeof(sample_t))
+#define CACHE_BANK_SAMPLES	(CACHE_SAMPLES/2)
+//matches no waveform type
+#define CACHE_TYPE_FORGOTTEN	0xFF
+//working memory of an engine, see Cache_Borrow
+#define CACHE_TYPE_BORROWED		0xFE
+//borrowed blocks start on a word
+#define CACHE_WORD_SAMPLES		(4/sizeof(sample_t))
+
+#if WAVEGEN_CACHE_BYTES/(WAVEGEN_SAMPLE_BITS/8)/2<MAX_MEMORY_ALLOWED
+#error "WAVEGEN_CACHE_BYTES must hold two full size tables"
+#endif
+
+//the largest static buffers, the small ones live in WAVEGEN_RAM_SPARE
+#if WAVEGEN_CACHE_BYTES+WAVEGEN_CACHE_ENTRIES*16+2*UPLOAD_MAX_SAMPLE*2+ENGINE_MEMORY_BYTES+2*(SER_RBUF_SIZE+8)+ \
+	WAVEGEN_RAM_SPARE>WAVEGEN_RAM_BYTES
+#error "The static buffers do not fit WAVEGEN_RAM_BYTES"
+#endif
+
+struct CACHE_ENTRY
+{
+	uint32_t offset;
+	uint32_t lastUse;
+	uint16_t noOfSample;
+	uint16_t amplitude;
+	uint8_t type;
+	uint8_t locks;
+	uint8_t valid;
+	uint8_t scaled;
+};
+
+//word aligned for the blocks lent out as other types
+static uint32_t TableCacheWords[WAVEGEN_CACHE_BYTES/4];
+#define TableCache			((sample_t*)TableCacheWords)
+static struct CACHE_ENTRY CacheEntry[WAVEGEN_CACHE_ENTRIES];
+
+static uint32_t UseCounter;
+static uint32_t CacheHits;
+static uint32_t CacheMisses;
+
+static volatile uint8_t CacheBusy;
+static volatile uint8_t CacheRetry;
+
+static void Cache_Enter(void)
+{
+	CacheBusy++;
+}
+
+void Cache_Leave(void)
+{
+	CacheBusy--;
+	if(CacheBusy==0&&CacheRetry)
+	{
+		CacheRetry = 0;
+		SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+	}
+}
+
+/* For PendSV only, pair a success with Cache_Leave */
+uint8_t Cache_TryEnter(void)
+{
+	if(CacheBusy)
+	{
+		CacheRetry = 1;
+		return 0;
+	}
+
+	CacheBusy++;
+	return 1;
+}
+
+static struct CACHE_ENTRY* Cache_Find(const void* pTable)
+{
+	uint32_t i;
+
+	for(i=0;i<WAVEGEN_CACHE_ENTRIES;i++)
+	{
+		if(CacheEntry[i].valid&&&TableCache[CacheEntry[i].offset]==pTable)
+			return &CacheEntry[i];
+	}
+
+	return NULL;
+}
+
+static uint8_t Cache_IsFree(uint32_t offset, uint32_t noOfSample)
+{
+	uint32_t i;
+
+	if(offset+noOfSample>CACHE_SAMPLES||
+		offset/CACHE_BANK_SAMPLES!=(offset+noOfSample-1)/CACHE_BANK_SAMPLES)
+		return 0;
+
+	for(i=0;i<WAVEGEN_CACHE_ENTRIES;i++)
+	{
+		if(CacheEntry[i].valid&&
+			offset<CacheEntry[i].offset+CacheEntry[i].noOfSample&&
+			CacheEntry[i].offset<offset+noOfSample)
+			return 0;
+	}
+
+	return 1;
+}
+
+//first fit, trying the start of each bank and the end of each table,
+//rounded up to a multiple of align samples
+static uint8_t Cache_FindGap(uint32_t noOfSample, uint32_t align, uint32_t* pOffset)
+{
+	uint32_t offset;
+	uint32_t i;
+
+	for(i=0;i<2;i++)
+	{
+		if(Cache_IsFree(i*CACHE_BANK_SAMPLES,noOfSample))
+		{
+			*pOffset = i*CACHE_BANK_SAMPLES;
+			return 1;
+		}
+	}
+
+	for(i=0;i<WAVEGEN_CACHE_ENTRIES;i++)
+	{
+		if(!CacheEntry[i].valid)
+			continue;
+
+		offset = (CacheEntry[i].offset+CacheEntry[i].noOfSample+align-1)/align*align;
+		if(Cache_IsFree(offset,noOfSample))
+		{
+			*pOffset = offset;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static struct CACHE_ENTRY* Cache_LeastRecent(void)
+{
+	struct CACHE_ENTRY* pOldest;
+	uint32_t i;
+
+	pOldest = NULL;
+	for(i=0;i<WAVEGEN_CACHE_ENTRIES;i++)
+	{
+		if(!CacheEntry[i].valid||CacheEntry[i].locks)
+			continue;
+
+		if(pOldest==NULL||CacheEntry[i].lastUse<pOldest->lastUse)
+			pOldest = &CacheEntry[i];
+	}
+
+	return pOldest;
+}
+
+static struct CACHE_ENTRY* Cache_Allocate(uint32_t noOfSample, uint32_t align)
+{
+	struct CACHE_ENTRY* pEntry;
+	uint32_t offset;
+	uint32_t i;
+
+	while(!Cache_FindGap(noOfSample,align,&offset))
+	{
+		pEntry = Cache_LeastRecent();
+		if(pEntry==NULL)
+			return NULL;
+		pEntry->valid = 0;
+	}
+
+	pEntry = NULL;
+	for(i=0;i<WAVEGEN_CACHE_ENTRIES;i++)
+	{
+		if(!CacheEntry[i].valid)
+		{
+			pEntry = &CacheEntry[i];
+			break;
+		}
+	}
+
+	//out of entries, dropping one only frees more room
+	if(pEntry==NULL)
+	{
+		pEntry = Cache_LeastRecent();
+		if(pEntry==NULL)
+			return NULL;
+		pEntry->valid = 0;
+	}
+
+	pEntry->offset = offset;
+	pEntry->noOfSample = noOfSample;
+	return pEntry;
+}
+
+static struct CACHE_ENTRY* Cache_FindScaleSource(enum WAVEFORM_TYPES waveform_types, uint32_t NoOfSample, uint32_t Amplitude_In_Resolution)
+{
+	struct CACHE_ENTRY* pSource;
+	uint32_t i;
+
+	pSource = NULL;
+	for(i=0;i<WAVEGEN_CACHE_ENTRIES;i++)
+	{
+		if(!CacheEntry[i].valid||CacheEntry[i].scaled||
+			CacheEntry[i].type!=waveform_types||CacheEntry[i].noOfSample!=NoOfSample||
+			2*CacheEntry[i].amplitude<Amplitude_In_Resolution||CacheEntry[i].amplitude==0)
+			continue;
+
+		//scaling down loses the least
+		if(pSource==NULL||CacheEntry[i].amplitude>pSource->amplitude)
+			pSource = &CacheEntry[i];
+	}
+
+	return pSource;
+}
+
+static const sample_t* Cache_FlashTable(enum WAVEFORM_TYPES waveform_types, uint32_t NoOfSample)
+{
+	uint32_t bits;
+
+	if(waveform_types>=FLASH_TABLE_SHAPES)
+		return NULL;
+
+	for(bits=FLASH_TABLE_MIN_BITS;bits<=FLASH_TABLE_MAX_BITS;bits++)
+	{
+		if(NoOfSample==1u<<bits)
+			return FlashTables[waveform_types][bits-FLASH_TABLE_MIN_BITS];
+	}
+
+	return NULL;
+}
+
+//fills an allocated entry from flash, a scale source or from scratch
+static void Cache_Fill(struct CACHE_ENTRY* pEntry, enum WAVEFORM_TYPES waveform_types, uint32_t Amplitude_In_Resolution,
+	const sample_t* pFlash, const struct CACHE_ENTRY* pSource)
+{
+	if(pFlash)
+	{
+		ScaleWaveFormTable(&TableCache[pEntry->offset],pFlash,pEntry->noOfSample,FLASH_TABLE_AMPLITUDE,Amplitude_In_Resolution);
+		pEntry->scaled = 1;
+	}
+	else if(pSource)
+	{
+		ScaleWaveFormTable(&TableCache[pEntry->offset],&TableCache[pSource->offset],pEntry->noOfSample,pSource->amplitude,Amplitude_In_Resolution);
+		pEntry->scaled = 1;
+	}
+	else
+	{
+		GenerateWaveFormTable(&TableCache[pEntry->offset],waveform_types,pEntry->noOfSample,Amplitude_In_Resolution);
+		pEntry->scaled = 0;
+	}
+
+	pEntry->type = waveform_types;
+	pEntry->amplitude = Amplitude_In_Resolution;
+	pEntry->locks = 0;
+	pEntry->valid = 1;
+}
+
+//pFlash is the full scale flash table of the parameters, if there is one
+static const sample_t* Cache_Get(enum WAVEFORM_TYPES waveform_types, uint32_t NoOfSample, uint32_t Amplitude_In_Resolution, const sample_t* pFlash)
+{
+	struct CACHE_ENTRY* pEntry;
+	struct CACHE_ENTRY* pSource;
+	uint32_t i;
+
+	if(pFlash&&Amplitude_In_Resolution==FLASH_TABLE_AMPLITUDE)
+	{
+		CacheHits++;
+		return pFlash;
+	}
+
+	for(i=0;i<WAVEGEN_CACHE_ENTRIES;i++)
+	{
+		pEntry = &CacheEntry[i];
+		if(pEntry->valid&&pEntry->type==waveform_types&&
+			pEntry->noOfSample==NoOfSample&&pEntry->amplitude==Amplitude_In_Resolution)
+		{
+			pEntry->lastUse = ++UseCounter;
+			CacheHits++;
+			return &TableCache[pEntry->offset];
+		}
+	}
+
+	if(pFlash)
+	{
+		//flash is never evicted, nothing has to be held while making room
+		pSource = NULL;
+		pEntry = Cache_Allocate(NoOfSample,1);
+	}
+	else
+	{
+		//keep the source while making room, unless it is in the way
+		pSource = Cache_FindScaleSource(waveform_types,NoOfSample,Amplitude_In_Resolution);
+		if(pSource)
+		{
+			pSource->locks++;
+			pEntry = Cache_Allocate(NoOfSample,1);
+			pSource->locks--;
+		}
+
+		if(pSource==NULL||pEntry==NULL)
+		{
+			pSource = NULL;
+			pEntry = Cache_Allocate(NoOfSample,1);
+		}
+	}
+
+	if(pEntry==NULL)
+		return NULL;
+
+	Cache_Fill(pEntry,waveform_types,Amplitude_In_Resolution,pFlash,pSource);
+	pEntry->lastUse = ++UseCounter;
+	CacheMisses++;
+
+	return &TableCache[pEntry->offset];
+}
+
+/* Returns the table for the parameters, generating it on a miss. Returns
+ * NULL only if every table that would have to go is locked. */
+const sample_t* Cache_GetTable(enum WAVEFORM_TYPES waveform_types, uint32_t NoOfSample, uint32_t Amplitude_In_Resolution)
+{
+	const sample_t* pTable;
+
+	Cache_Enter();
+	pTable = Cache_Get(waveform_types,NoOfSample,Amplitude_In_Resolution,Cache_FlashTable(waveform_types,NoOfSample));
+	Cache_Leave();
+
+	return pTable;
+}
+
+static uint8_t Cache_Make(enum WAVEFORM_TYPES waveform_types, uint32_t NoOfSample, uint32_t Amplitude_In_Resolution)
+{
+	struct CACHE_ENTRY* pEntry;
+	const sample_t* pFlash;
+	uint32_t offset;
+	uint32_t i;
+
+	pFlash = Cache_FlashTable(waveform_types,NoOfSample);
+	if(pFlash&&Amplitude_In_Resolution==FLASH_TABLE_AMPLITUDE)
+		return 1;
+
+	pEntry = NULL;
+	for(i=0;i<WAVEGEN_CACHE_ENTRIES;i++)
+	{
+		if(!CacheEntry[i].valid)
+		{
+			if(pEntry==NULL)
+				pEntry = &CacheEntry[i];
+		}
+		else if(CacheEntry[i].type==waveform_types&&
+			CacheEntry[i].noOfSample==NoOfSample&&CacheEntry[i].amplitude==Amplitude_In_Resolution)
+		{
+			return 1;
+		}
+	}
+
+	if(pEntry==NULL||!Cache_FindGap(NoOfSample,1,&offset))
+		return 0;
+
+	pEntry->offset = offset;
+	pEntry->noOfSample = NoOfSample;
+	Cache_Fill(pEntry,waveform_types,Amplitude_In_Resolution,pFlash,
+		pFlash?NULL:Cache_FindScaleSource(waveform_types,NoOfSample,Amplitude_In_Resolution));
+	pEntry->lastUse = 0;
+
+	return 1;
+}
+
+/* Makes a table ahead of its use in room that is already free, nothing
+ * is evicted for it. It stays the first to go until Cache_GetTable finds
+ * it, so a table that is never asked for costs no other table its place.
+ * Returns 0 if there was no room. */
+uint8_t Cache_Prefetch(enum WAVEFORM_TYPES waveform_types, uint32_t NoOfSample, uint32_t Amplitude_In_Resolution)
+{
+	uint8_t made;
+
+	Cache_Enter();
+	made = Cache_Make(waveform_types,NoOfSample,Amplitude_In_Resolution);
+	Cache_Leave();
+
+	return made;
+}
+
+/* Lends bytes of the pool to an engine, word aligned and locked once.
+ * Tables in the way are evicted as for a miss. Cache_Unlock gives it
+ * back. Returns NULL only if every table that would have to go is
+ * locked. */
+void* Cache_Borrow(uint32_t bytes)
+{
+	struct CACHE_ENTRY* pEntry;
+	void* pBlock;
+
+	Cache_Enter();
+	pBlock = NULL;
+	pEntry = Cache_Allocate((bytes+sizeof(sample_t)-1)/sizeof(sample_t),CACHE_WORD_SAMPLES);
+	if(pEntry)
+	{
+		pEntry->type = CACHE_TYPE_BORROWED;
+		pEntry->amplitude = 0;
+		pEntry->scaled = 1;
+		pEntry->locks = 1;
+		pEntry->valid = 1;
+		pEntry->lastUse = ++UseCounter;
+		pBlock = &TableCache[pEntry->offset];
+	}
+	Cache_Leave();
+
+	return pBlock;
+}
+
+void Cache_Lock(const void* pTable)
+{
+	struct CACHE_ENTRY* pEntry;
+
+	Cache_Enter();
+	pEntry = Cache_Find(pTable);
+	if(pEntry)
+		pEntry->locks++;
+	Cache_Leave();
+}
+
+void Cache_Unlock(const void* pTable)
+{
+	struct CACHE_ENTRY* pEntry;
+
+	Cache_Enter();
+	pEntry = Cache_Find(pTable);
+	if(pEntry&&pEntry->locks)
+	{
+		pEntry->locks--;
+		//a borrowed block is of no use to anyone else
+		if(pEntry->locks==0&&pEntry->type==CACHE_TYPE_BORROWED)
+			pEntry->valid = 0;
+	}
+	Cache_Leave();
+}
+
+/* Drops every table of a shape that changed. Tables still locked can no
+ * longer be found or used as a source, they go once unlocked. */
+void Cache_Forget(enum WAVEFORM_TYPES waveform_types)
+{
+	uint32_t i;
+
+	Cache_Enter();
+	for(i=0;i<WAVEGEN_CACHE_ENTRIES;i++)
+	{
+		if(!CacheEntry[i].valid||CacheEntry[i].type!=waveform_types)
+			continue;
+
+		if(CacheEntry[i].locks)
+			CacheEntry[i].type = CACHE_TYPE_FORGOTTEN;
+		else
+			CacheEntry[i].valid = 0;
+	}
+	Cache_Leave();
+}
+
+uint32_t GetCacheHits(void)
+{
+	return CacheHits;
+}
+
+uint32_t GetCacheMisses(void)
+{
+	return CacheMisses;
+}
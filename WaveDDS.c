@@ -0,0 +1,298 @@
+#include "WaveGenPriv.h"
+
+
+/* Direct digital synthesis: TIM6 clocks the DAC at a fixed rate and a 32 bit
+ * phase accumulator indexes a one-cycle lookup table. The DMA plays a
+ * circular ping-pong buffer, each half is refilled from the half transfer
+ * and transfer complete interrupts while the other half is played.
+ *
+ * AM and FM run a second phase accumulator over a low-rate modulating
+ * table while a half is refilled. Its value m is a Q11 signed code.
+ *	AM: out = mid+(carrier-mid)*(1+d*m)/(1+d), d the depth in percent
+ *	FM: phase step = tuning word+m*deviation, deviation in hertz
+ * Both are a multiply and shift per sample in Q15, no table is rebuilt.
+ *
+ * A sawtooth or square with harmonics past Nyquist would fold them back
+ * as tones that are not harmonics. Above the frequency where the full
+ * table still fits, they play from the band-limited flash tables instead,
+ * the level of the octave keeping every harmonic below Nyquist. Those are
+ * read straight from flash at full scale and the amplitude is applied as
+ * a Q15 gain on every lookup, so crossing an octave only moves the lookup
+ * pointer and needs no cache room. */
+
+//the ping-pong buffer is in the engine memory
+#define DDSBuffer				(EngineMemory.dds)
+
+//lookup tables come from the table cache and stay locked while in use
+static const sample_t* volatile pLookup;
+static volatile uint32_t LookupShift;
+//Q15, 32768 for a table already at the amplitude
+static volatile uint32_t LookupGain;
+static volatile uint32_t TuningWord;
+static uint32_t Phase;
+
+static enum WAVEFORM_TYPES LookupType;
+static uint32_t LookupAmplitude;
+static uint32_t LookupLevel;
+
+static uint32_t SampleRate;
+static uint8_t DDSRunning;
+
+static volatile enum WAVEGEN_MODULATIONS Modulation;
+//the modulating table is only held while the DDS engine plays
+static const sample_t* pModLookup;
+static enum WAVEFORM_TYPES ModType;
+static uint32_t ModShift;
+static uint32_t ModWord;
+static uint32_t ModPhase;
+//AM gain = AMOffset+AMScale*m in Q15
+static int32_t AMOffset;
+static int32_t AMScale;
+//FM step per Q11 unit of m
+static int32_t FMStep;
+
+//modulating value as a signed Q11 code
+#define MOD_VALUE(sample)		((int32_t)((sample)<<SAMPLE_SHIFT)-DAC_RESOLUTION/2)
+
+//lookup table sample at the amplitude
+#define LOOKUP(pTable,index,gain)	((int32_t)(((uint32_t)(pTable)[index]*(gain)+0x4000)>>15))
+
+static void DDS_Fill(sample_t* pOut)
+{
+	const sample_t* pTable;
+	uint32_t shift;
+	uint32_t lookupgain;
+	uint32_t step;
+	uint32_t phase;
+	uint32_t modphase;
+	int32_t mid;
+	int32_t gain;
+	uint32_t i;
+
+	pTable = pLookup;
+	shift = LookupShift;
+	lookupgain = LookupGain;
+	step = TuningWord;
+	phase = Phase;
+	modphase = ModPhase;
+
+	switch(Modulation)
+	{
+		case WAVEGEN_MODULATION_AM:
+			mid = TO_SAMPLE(LookupAmplitude)/2;
+			for(i=0;i<DDS_HALF_BUFFER;i++)
+			{
+				gain = AMOffset+((AMScale*MOD_VALUE(pModLookup[modphase>>ModShift]))>>11);
+				pOut[i]=mid+(((LOOKUP(pTable,phase>>shift,lookupgain)-mid)*gain)>>15);
+				phase += step;
+				modphase += ModWord;
+			}
+		break;
+		case WAVEGEN_MODULATION_FM:
+			for(i=0;i<DDS_HALF_BUFFER;i++)
+			{
+				pOut[i]=LOOKUP(pTable,phase>>shift,lookupgain);
+				phase += step+FMStep*MOD_VALUE(pModLookup[modphase>>ModShift]);
+				modphase += ModWord;
+			}
+		break;
+		default:
+			for(i=0;i<DDS_HALF_BUFFER;i++)
+			{
+				pOut[i]=LOOKUP(pTable,phase>>shift,lookupgain);
+				phase += step;
+			}
+		break;
+	}
+
+	Phase = phase;
+	ModPhase = modphase;
+}
+
+static void DDS_Refill(DMA_event_t event)
+{
+	if(event==DMA_EVENT_HALF_TRANSFER)
+		DDS_Fill(&DDSBuffer[0]);
+	else if(event==DMA_EVENT_TRANSFER_COMPLETE)
+		DDS_Fill(&DDSBuffer[DDS_HALF_BUFFER]);
+}
+
+static uint32_t DDS_SampleRate(void)
+{
+	return SystemCoreClock/(SystemCoreClock/DDS_SAMPLE_RATE);
+}
+
+static uint32_t DDS_TuningWord(uint32_t frequency_mhz)
+{
+	uint64_t scale;
+
+	//tuning word = f*2^32/fs, rounded
+	scale = (uint64_t)SampleRate*1000;
+	return (uint32_t)((((uint64_t)frequency_mhz<<32)+scale/2)/scale);
+}
+
+static const sample_t* DDS_LockModTable(enum WAVEFORM_TYPES waveform_types, uint32_t tablebits)
+{
+	const sample_t* pTable;
+
+	pTable = Cache_GetTable(waveform_types,1<<tablebits,DAC_RESOLUTION-1);
+	if(pTable)
+		Cache_Lock(pTable);
+
+	return pTable;
+}
+
+/* Band-limited level for the frequency, FLASH_BANDLIMIT_LEVELS if the
+ * full table plays without folding */
+static uint32_t DDS_BandLimitLevel(enum WAVEFORM_TYPES waveform_types, uint32_t frequency_mhz)
+{
+	uint32_t harmonics;
+	uint32_t level;
+
+	if(waveform_types!=WAVEFORM_TYPE_SAWTOOTH&&waveform_types!=WAVEFORM_TYPE_SQUARE)
+		return FLASH_BANDLIMIT_LEVELS;
+
+	//harmonics below Nyquist
+	harmonics = (uint32_t)((uint64_t)SampleRate*500/frequency_mhz);
+	if(harmonics>=(1<<DDS_TABLE_BITS)/2)
+		return FLASH_BANDLIMIT_LEVELS;
+
+	level = 0;
+	while(level<FLASH_BANDLIMIT_LEVELS-1&&(FLASH_BANDLIMIT_MAX_HARMONIC>>level)>harmonics)
+		level++;
+
+	return level;
+}
+
+uint32_t DDS_Generate(enum WAVEFORM_TYPES waveform_types, uint32_t frequency_mhz, uint32_t amplitude_in_resolution)
+{
+	const sample_t* pTable;
+	uint32_t tablebits;
+	uint32_t tablegain;
+	uint32_t level;
+	uint16_t timercount;
+
+	timercount = SystemCoreClock/DDS_SAMPLE_RATE;
+	SampleRate = DDS_SampleRate();
+	level = DDS_BandLimitLevel(waveform_types,frequency_mhz);
+
+	//a frequency-only change just retunes, the phase carries on. An
+	//uploaded shape may have changed, its table is looked up again.
+	if(!DDSRunning||waveform_types!=LookupType||amplitude_in_resolution!=LookupAmplitude||
+		level!=LookupLevel||waveform_types==WAVEFORM_TYPE_ARBITRARY)
+	{
+		if(level<FLASH_BANDLIMIT_LEVELS)
+		{
+			tablebits = FLASH_BANDLIMIT_BITS;
+			tablegain = ((amplitude_in_resolution<<15)+FLASH_TABLE_AMPLITUDE/2)/FLASH_TABLE_AMPLITUDE;
+			pTable = BandLimitTables[(waveform_types==WAVEFORM_TYPE_SQUARE)?1:0][level];
+		}
+		else
+		{
+			//a square only needs its two levels
+			tablebits = (waveform_types==WAVEFORM_TYPE_SQUARE)?1:DDS_TABLE_BITS;
+			tablegain = 1<<15;
+			pTable = Cache_GetTable(waveform_types,1<<tablebits,amplitude_in_resolution);
+			if(pTable==NULL)
+				return 0;
+		}
+		Cache_Lock(pTable);
+
+		//the refill interrupt cannot be halfway through the old table here
+		Cache_Unlock(pLookup);
+		__disable_irq();
+		pLookup = pTable;
+		LookupShift = 32-tablebits;
+		LookupGain = tablegain;
+		__enable_irq();
+
+		LookupType = waveform_types;
+		LookupAmplitude = amplitude_in_resolution;
+		LookupLevel = level;
+	}
+
+	TuningWord = DDS_TuningWord(frequency_mhz);
+
+	if(!DDSRunning)
+	{
+		if(Modulation!=WAVEGEN_MODULATION_NONE)
+		{
+			pModLookup = DDS_LockModTable(ModType,32-ModShift);
+			if(pModLookup==NULL)
+			{
+				//stopped, so there was no lookup before this call
+				Cache_Unlock(pLookup);
+				pLookup = NULL;
+				return 0;
+			}
+		}
+
+		Phase = 0;
+		DDS_Fill(&DDSBuffer[0]);
+		DDS_Fill(&DDSBuffer[DDS_HALF_BUFFER]);
+
+		ConfigureDAC(DDSBuffer,2*DDS_HALF_BUFFER,timercount-1,0,OUTPUT_SAMPLE,&DDS_Refill);
+		DMA_enableInterrupt(DMA_CHN, DMA_EVENT_HALF_TRANSFER);
+		DMA_enableInterrupt(DMA_CHN, DMA_EVENT_TRANSFER_COMPLETE);
+		DDSRunning = 1;
+	}
+
+	//frequency actually produced by the rounded tuning word
+	return (uint32_t)(((uint64_t)TuningWord*SampleRate*1000+0x80000000u)>>32);
+}
+
+/* Takes effect at the next refill, the carrier phase carries on. depth
+ * is in percent for AM and the peak deviation in hertz for FM. */
+uint8_t DDS_SetModulation(enum WAVEGEN_MODULATIONS modulation, enum WAVEFORM_TYPES waveform_types, uint32_t rate_mhz, uint32_t depth)
+{
+	const sample_t* pTable;
+	const sample_t* pOld;
+	uint32_t tablebits;
+	uint32_t modword;
+	int32_t fmstep;
+
+	pTable = NULL;
+	tablebits = 0;
+	if(modulation!=WAVEGEN_MODULATION_NONE)
+	{
+		tablebits = (waveform_types==WAVEFORM_TYPE_SQUARE)?1:DDS_MOD_TABLE_BITS;
+		//a stopped engine takes the table when it starts
+		if(DDSRunning)
+		{
+			pTable = DDS_LockModTable(waveform_types,tablebits);
+			if(pTable==NULL)
+				return 0;
+		}
+	}
+
+	SampleRate = DDS_SampleRate();
+	modword = DDS_TuningWord(rate_mhz);
+	fmstep = (int32_t)(DDS_TuningWord(depth*1000)>>11);
+
+	__disable_irq();
+	pOld = pModLookup;
+	pModLookup = pTable;
+	ModType = waveform_types;
+	ModShift = 32-tablebits;
+	ModWord = modword;
+	AMOffset = (32768*100)/(100+depth);
+	AMScale = (32768*depth)/(100+depth);
+	FMStep = fmstep;
+	Modulation = modulation;
+	__enable_irq();
+
+	Cache_Unlock(pOld);
+	return 1;
+}
+
+void DDS_Stop(void)
+{
+	TIMER_disable(TIM6);
+	DMA_disableInterrupt(DMA_CHN, DMA_EVENT_HALF_TRANSFER);
+	DMA_disableInterrupt(DMA_CHN, DMA_EVENT_TRANSFER_COMPLETE);
+	Cache_Unlock(pLookup);
+	pLookup = NULL;
+	Cache_Unlock(pModLookup);
+	pModLookup = NULL;
+	DDSRunning = 0;
+}
@@ -1,26 +1,75 @@
-#include <math.h>
+#include "WaveGenPriv.h"
 
-#include "WaveGen.h"
+enum SWITCH_STAGES
+{
+	SWITCH_STAGE_IDLE=0,
+	SWITCH_STAGE_PENDING,	//waiting for the DMA to reach a switch point
+	SWITCH_STAGE_REARM		//new table started mid-cycle, reload it whole at TC
+};
+
+struct WAVEFORM_BUFFER
+{
+	const void* pTable;			//sample_t, or dual_t in dual mode
+	uint32_t noOfSample;
+	uint16_t timerCount;
+	uint16_t timerPrescale;
+};
 
+static enum WAVEGEN_ENGINES Engine = WAVEGEN_ENGINE_TABLE;
+static enum WAVEGEN_SWITCH_MODES SwitchMode = WAVEGEN_SWITCH_CYCLE;
+static volatile enum SWITCH_STAGES SwitchStage = SWITCH_STAGE_IDLE;
+//cache locks held on the playing table and on a pending next table
+static const void* HeldTable;
+static uint8_t NextLocked;
+static volatile uint32_t ActiveNoOfSample;
+static struct WAVEFORM_BUFFER NextWaveform;
+static uint8_t OutputRunning;
+//playing faster than a switch interrupt can keep up with
+static uint8_t ActiveFast;
+static uint32_t ActualFrequency;
 
-uint32_t DMAData[MAX_MEMORY_ALLOWED];
+static enum WAVEGEN_SPEED_MODES SpeedMode = WAVEGEN_SPEED_NORMAL;
+static uint32_t SampleFloor = HIGH_SPEED_DEFAULT_SAMPLE;
+
+static enum WAVEGEN_MODULATIONS CurrentModulation = WAVEGEN_MODULATION_NONE;
+static enum WAVEGEN_DUAL_MODES DualMode = WAVEGEN_DUAL_OFF;
+static uint32_t DualPhase;
+
+union ENGINE_MEMORY EngineMemory;
+//fails to compile if a member outgrows ENGINE_MEMORY_BYTES
+typedef char ENGINE_MEMORY_SIZE_CHECK[(sizeof(union ENGINE_MEMORY)==ENGINE_MEMORY_BYTES)?1:-1];
+
+/* Highest frequency the DAC engines reach in the current modes */
+static uint32_t DACMaxFrequency(void)
+{
+	if(Engine==WAVEGEN_ENGINE_DDS)
+		return DDS_MAX_FREQUENCY;
+	if(SpeedMode==WAVEGEN_SPEED_HIGH)
+		return 1000000000/(DAC_FAST_SAMPLE_WAIT_TIME_NS*SampleFloor);
+	return MAX_FREQUENCY;
+}
 
+/* Checks the DAC path of the current engine, see GetMaxFreq for what
+ * GenerateWaveform reaches beyond it */
 uint8_t IsParameterAllowed(enum WAVEFORM_TYPES waveform_types, uint32_t frequency, float amplitude)
 {
 	uint32_t numberOfSample;
 	uint32_t period_in_ns;
 	
-	period_in_ns=1000000000/frequency;
-	
 	if(amplitude>MAX_AMPLITUDE_FLOAT||amplitude<MIN_AMPLITUDE_FLOAT)
 	{
 		return 0;
 	}
 	
-	numberOfSample = period_in_ns/DAC_SAMPLE_WAIT_TIME_NS;
-	
-	if(numberOfSample<MIN_SAMPLE_PER_CYCLE)
+	if(frequency<MIN_FREQUENCY||frequency>DACMaxFrequency())
 		return 0;
+	
+	if(Engine==WAVEGEN_ENGINE_DDS)
+		return 1;
+	
+	period_in_ns=1000000000/frequency;
+	
+	numberOfSample = period_in_ns/DAC_SAMPLE_WAIT_TIME_NS;
 		
 	if(numberOfSample>MAX_MEMORY_ALLOWED)
 	{
@@ -34,12 +83,111 @@ uint8_t IsParameterAllowed(enum WAVEFORM_TYPES waveform_types, uint32_t frequenc
 	return 1;
 }
 
-static uint8_t ProcessWaveformParam(enum WAVEFORM_TYPES waveform_types, uint32_t frequency, float amplitude, uint32_t* pTiming_ns, uint32_t* pNoofSample)
+/* Searches sample count, prescaler and reload together for the timing
+ * closest to the requested frequency, preferring more samples on a tie.
+ * Frequencies are in millihertz, the timer runs from SystemCoreClock.
+ * powerOfTwo limits the search to the lengths of the flash tables. */
+uint8_t SolveTiming(uint32_t frequency_mhz, uint32_t minSample, uint32_t maxSample, uint8_t powerOfTwo, struct WAVEFORM_TIMING* pTiming)
 {
-	uint32_t period_in_ns;
+	uint32_t clock;
+	uint32_t total;
+	uint32_t ticks;
+	uint32_t prescale;
+	uint32_t count;
+	uint32_t error;
+	uint32_t best_error;
+	uint32_t n;
+
+	//TIM6 sits on APB1 which main.c runs undivided
+	clock = SystemCoreClock;
+	total = (uint32_t)(((uint64_t)clock*1000+frequency_mhz/2)/frequency_mhz);
+
+	best_error = 0xFFFFFFFF;
+	for(n=maxSample;n>=minSample;n--)
+	{
+		if(powerOfTwo&&(n&(n-1)))
+			continue;
+
+		ticks = (total+n/2)/n;
+		if(ticks<2)
+			continue;
+
+		prescale = (ticks-1)>>16;
+		count = (ticks+(prescale+1)/2)/(prescale+1);
+		ticks = n*(prescale+1)*count;
+		error = (ticks>total)?(ticks-total):(total-ticks);
+
+		if(error<best_error)
+		{
+			best_error = error;
+			pTiming->noOfSample = n;
+			pTiming->timerCount = count-1;
+			pTiming->timerPrescale = prescale;
+			pTiming->frequency_mhz = (uint32_t)(((uint64_t)clock*1000+ticks/2)/ticks);
+			pTiming->error = error;
+
+			if(error==0)
+				break;
+		}
+	}
+
+	return best_error!=0xFFFFFFFF;
+}
+
+uint32_t AmplitudeToResolution(float amplitude)
+{
+	uint32_t amplitude_in_resolution;
+
+	amplitude_in_resolution = amplitude*DAC_RESOLUTION/DAC_VREF;
+	//full scale would wrap to 0 in the 12 bit data register
+	if(amplitude_in_resolution>DAC_RESOLUTION-1)
+		amplitude_in_resolution = DAC_RESOLUTION-1;
+
+	return amplitude_in_resolution;
+}
+
+/* Most samples per cycle the table engine plays at frequency_mhz, 0 if
+ * it is out of reach. Past MIN_SAMPLE_PER_CYCLE at the normal rate, high
+ * speed mode clocks the DAC faster, up to one sample per
+ * DAC_FAST_SAMPLE_WAIT_TIME_NS, and then gives up samples down to the
+ * floor. */
+uint32_t MaxSamplePerCycle(uint32_t frequency_mhz)
+{
+	uint32_t maxSample;
+
+	//samples that fit the period at the normal DAC rate
+	maxSample = (uint32_t)(1000000000000ull/((uint64_t)frequency_mhz*DAC_SAMPLE_WAIT_TIME_NS));
+
+	if(maxSample<MIN_SAMPLE_PER_CYCLE)
+	{
+		if(SpeedMode!=WAVEGEN_SPEED_HIGH)
+			return 0;
+
+		maxSample = (uint32_t)(1000000000000ull/((uint64_t)frequency_mhz*DAC_FAST_SAMPLE_WAIT_TIME_NS));
+		if(maxSample>MIN_SAMPLE_PER_CYCLE)
+			maxSample = MIN_SAMPLE_PER_CYCLE;
+		if(maxSample<SampleFloor)
+			return 0;
+	}
+
+	if(maxSample>MAX_MEMORY_ALLOWED)
+	{
+		//the table is full, the samples have to be held longer
+		if(1000000000000ull/((uint64_t)frequency_mhz*DAC_SAMPLE_MAX_DRAG_TIME_NS)>MAX_MEMORY_ALLOWED)
+			return 0;
+		maxSample = MAX_MEMORY_ALLOWED;
+	}
+
+	return maxSample;
+}
+
+uint8_t ProcessWaveformParam(enum WAVEFORM_TYPES waveform_types, uint32_t frequency_mhz, float amplitude, struct WAVEFORM_TIMING* pTiming)
+{
+	struct WAVEFORM_TIMING flashTiming;
+	uint32_t floorSample;
+	uint32_t minSample;
+	uint32_t maxSample;
 
-	period_in_ns=1000000000/frequency;
-	
 	if(amplitude>MAX_AMPLITUDE_FLOAT||amplitude<MIN_AMPLITUDE_FLOAT)
 	{
 		return 0;
@@ -50,113 +198,209 @@ static uint8_t ProcessWaveformParam(enum WAVEFORM_TYPES waveform_types, uint32_t
 		case WAVEFORM_TYPE_SINE:
 		case WAVEFORM_TYPE_SAWTOOTH :
 		case WAVEFORM_TYPE_TRIANGULAR:
-			*pNoofSample = period_in_ns/DAC_SAMPLE_WAIT_TIME_NS;
-		
-			if(*pNoofSample<MIN_SAMPLE_PER_CYCLE)
+		case WAVEFORM_TYPE_ARBITRARY:
+			maxSample = MaxSamplePerCycle(frequency_mhz);
+			if(maxSample==0)
 				return 0;
-				
-			if(*pNoofSample>MAX_MEMORY_ALLOWED)
+
+			//dual tables are shorter, low frequencies hold each sample longer
+			if(DualMode!=WAVEGEN_DUAL_OFF&&maxSample>DUAL_MAX_SAMPLE)
+				maxSample = DUAL_MAX_SAMPLE;
+
+			//an uploaded shape plays sample for sample when it fits
+			if(waveform_types==WAVEFORM_TYPE_ARBITRARY)
 			{
-				*pNoofSample=period_in_ns/DAC_SAMPLE_MAX_DRAG_TIME_NS;
-				if(*pNoofSample>MAX_MEMORY_ALLOWED)
-				{
+				if(GetUploadLength()==0)
 					return 0;
-				}
-				else
-				{
-					*pTiming_ns=period_in_ns/MAX_MEMORY_ALLOWED;
-					*pNoofSample=MAX_MEMORY_ALLOWED;
-				}
+				if(GetUploadLength()<=maxSample&&SolveTiming(frequency_mhz, GetUploadLength(), GetUploadLength(), 0, pTiming))
+					return 1;
 			}
-			else
+
+			//allow trading up to half the samples for a more exact frequency
+			floorSample = (SpeedMode==WAVEGEN_SPEED_HIGH)?SampleFloor:MIN_SAMPLE_PER_CYCLE;
+			minSample = (maxSample/2>floorSample)?maxSample/2:floorSample;
+			if(minSample>maxSample)
+				minSample = maxSample;
+			if(!SolveTiming(frequency_mhz, minSample, maxSample, 0, pTiming))
+				return 0;
+
+			//a flash table plays without generating, take it when no less exact
+			if(waveform_types<FLASH_TABLE_SHAPES&&AmplitudeToResolution(amplitude)==FLASH_TABLE_AMPLITUDE&&
+				SolveTiming(frequency_mhz, minSample, maxSample, 1, &flashTiming)&&
+				flashTiming.error<=pTiming->error)
 			{
-				//timing = DAC_SAMPLE_WAIT_TIME_MS;
-				*pTiming_ns =  period_in_ns/(*pNoofSample);
+				*pTiming = flashTiming;
 			}
-		break;
+			return 1;
 		case WAVEFORM_TYPE_SQUARE:
-			*pNoofSample=2;
-			*pTiming_ns = period_in_ns/2;
-		break;
+			return SolveTiming(frequency_mhz, 2, 2, 0, pTiming);
 		default:
 			return 0;
 	}
-	
-	return 1;
 }
 
-static void GenerateSawToothTable(uint32_t NoOfSample, uint32_t Amplitude_In_Resolution)
+static uint32_t TableSampleBytes(void)
 {
-	uint32_t i;
-	for(i=0;i<NoOfSample;i++)
-	{
-		DMAData[i]=(Amplitude_In_Resolution*i/NoOfSample);
-	}
+	return (DualMode!=WAVEGEN_DUAL_OFF)?sizeof(dual_t):sizeof(sample_t);
 }
 
-static void GenerateTriangularTable(uint32_t NoOfSample, uint32_t Amplitude_In_Resolution)
+/* Packs channel 1 and the channel 2 derived from it into a block
+ * borrowed from the cache, locked like a table. The phase offset resolves
+ * to whole samples. Returns NULL if there is no room. */
+static const dual_t* PackDualTable(const sample_t* pTable, uint32_t noofsample, uint32_t amplitude_in_resolution)
 {
+	dual_t* pDual;
+	uint32_t offset;
 	uint32_t i;
 
-	for(i=0;i<NoOfSample/2;i++)
-	{
-		DMAData[i]=2*(Amplitude_In_Resolution*i/NoOfSample);
-	}
+	//the source must not be evicted to make the room
+	Cache_Lock(pTable);
+	pDual = Cache_Borrow(noofsample*sizeof(dual_t));
+	Cache_Unlock(pTable);
+	if(pDual==NULL)
+		return NULL;
 
-	for(i=0;i<NoOfSample/2;i++)
+	if(DualMode==WAVEGEN_DUAL_COMPLEMENT)
 	{
-		DMAData[i+NoOfSample/2]=Amplitude_In_Resolution-(2*(Amplitude_In_Resolution*i/NoOfSample));
+		for(i=0;i<noofsample;i++)
+			pDual[i]=TO_DUAL(pTable[i],TO_SAMPLE(amplitude_in_resolution)-pTable[i]);
+		return pDual;
 	}
-}
 
-static void GenerateSineTable(uint32_t NoOfSample, uint32_t Amplitude_In_Resolution)
-{
-	uint32_t i;
-	
-	for(i=0;i<NoOfSample;i++)
+	offset = (DualMode==WAVEGEN_DUAL_QUADRATURE)?90:DualPhase;
+	offset = (offset*noofsample+180)/360;
+	if(offset>=noofsample)
+		offset = 0;
+
+	for(i=0;i<noofsample;i++)
 	{
-		DMAData[i]=(sin(i*2*PI_VALUE/NoOfSample)+1)*(Amplitude_In_Resolution+1)/2;
+		pDual[i]=TO_DUAL(pTable[i],pTable[offset]);
+		if(++offset==noofsample)
+			offset = 0;
 	}
+
+	return pDual;
 }
 
-static void GenerateSquareTable(uint32_t Amplitude_In_Resolution)
+static void FinishSwitch(void)
 {
-	DMAData[0]=0;
-	DMAData[1]=Amplitude_In_Resolution;
+	DMA_disableInterrupt(DMA_CHN, DMA_EVENT_HALF_TRANSFER);
+	DMA_disableInterrupt(DMA_CHN, DMA_EVENT_TRANSFER_COMPLETE);
+	SwitchStage = SWITCH_STAGE_IDLE;
 }
 
-static void GenerateWaveFormTable(enum WAVEFORM_TYPES waveform_types, uint32_t NoOfSample, uint32_t Amplitude_In_Resolution)
+/* DMA callback, only enabled while a switch is outstanding.
+ * The timer values land in the preload registers and take effect at the
+ * next update event. The DAC requests its DMA only after moving DHR to
+ * DOR, so DHR already holds the last sample of the old table here and
+ * that sample is held for one period of the new timing before the first
+ * sample of the new table comes out. */
+static void SwitchBuffer(DMA_event_t event)
 {
-	switch (waveform_types)
+	uint32_t done;
+	uint32_t start;
+
+	switch(SwitchStage)
 	{
-		case WAVEFORM_TYPE_SINE:
-			GenerateSineTable(NoOfSample,Amplitude_In_Resolution);
-		break;
-		case WAVEFORM_TYPE_SAWTOOTH:
-			GenerateSawToothTable(NoOfSample,Amplitude_In_Resolution);
+		case SWITCH_STAGE_PENDING:
+			if(event==DMA_EVENT_TRANSFER_COMPLETE)
+			{
+				DMA_setSource(DMA_CHN, NextWaveform.pTable, NextWaveform.noOfSample);
+				TIMER_setCount(TIM6, NextWaveform.timerCount);
+				TIMER_setPrescaler(TIM6, NextWaveform.timerPrescale);
+				ActiveNoOfSample = NextWaveform.noOfSample;
+				FinishSwitch();
+			}
+			else if(event==DMA_EVENT_HALF_TRANSFER)
+			{
+				//continue the new table from the phase the old one reached
+				done = ActiveNoOfSample-DMA_getRemaining(DMA_CHN);
+				start = (done*NextWaveform.noOfSample+ActiveNoOfSample/2)/ActiveNoOfSample;
+				if(start>=NextWaveform.noOfSample)
+					start = 0;
+
+				DMA_setSource(DMA_CHN, (const uint8_t*)NextWaveform.pTable+start*TableSampleBytes(), NextWaveform.noOfSample-start);
+				TIMER_setCount(TIM6, NextWaveform.timerCount);
+				TIMER_setPrescaler(TIM6, NextWaveform.timerPrescale);
+				ActiveNoOfSample = NextWaveform.noOfSample;
+
+				DMA_disableInterrupt(DMA_CHN, DMA_EVENT_HALF_TRANSFER);
+				SwitchStage = SWITCH_STAGE_REARM;
+			}
 		break;
-		case WAVEFORM_TYPE_TRIANGULAR:
-			GenerateTriangularTable(NoOfSample,Amplitude_In_Resolution);
+		case SWITCH_STAGE_REARM:
+			if(event==DMA_EVENT_TRANSFER_COMPLETE)
+			{
+				DMA_setSource(DMA_CHN, NextWaveform.pTable, NextWaveform.noOfSample);
+				FinishSwitch();
+			}
 		break;
-		case WAVEFORM_TYPE_SQUARE:
-			GenerateSquareTable(Amplitude_In_Resolution);
+		default:
 		break;
 	}
 }
 
-static void ConfigureDAC(uint32_t noofsample, uint32_t periodinns)
+/* Settles any outstanding switch and leaves a single cache lock on the
+ * table the DMA is playing, so every other table may be evicted */
+static void SettleSwitch(void)
+{
+	uint8_t cancelled;
+
+	cancelled = 0;
+	__disable_irq();
+	if(SwitchStage==SWITCH_STAGE_PENDING)
+	{
+		FinishSwitch();
+		cancelled = 1;
+	}
+	else if(SwitchStage==SWITCH_STAGE_REARM)
+	{
+		//only the reload is outstanding, do it now and take the phase jump
+		DMA_setSource(DMA_CHN, NextWaveform.pTable, NextWaveform.noOfSample);
+		FinishSwitch();
+	}
+	__enable_irq();
+
+	//the lock taken for the next table is dropped or becomes the held one
+	if(NextLocked)
+	{
+		if(cancelled)
+		{
+			Cache_Unlock(NextWaveform.pTable);
+		}
+		else
+		{
+			Cache_Unlock(HeldTable);
+			HeldTable = NextWaveform.pTable;
+		}
+		NextLocked = 0;
+	}
+}
+
+static void RequestSwitch(const void* pTable, uint32_t noofsample, uint16_t timercount, uint16_t timerprescale)
+{
+	NextWaveform.pTable = pTable;
+	NextWaveform.noOfSample = noofsample;
+	NextWaveform.timerCount = timercount;
+	NextWaveform.timerPrescale = timerprescale;
+
+	SwitchStage = SWITCH_STAGE_PENDING;
+	DMA_enableInterrupt(DMA_CHN, DMA_EVENT_TRANSFER_COMPLETE);
+	if(SwitchMode==WAVEGEN_SWITCH_PHASE)
+		DMA_enableInterrupt(DMA_CHN, DMA_EVENT_HALF_TRANSFER);
+}
+
+void ConfigureDAC(const void* pTable, uint32_t noofsample, uint16_t timercount, uint16_t timerprescale, enum OUTPUT_FORMATS format, void (*callback)(DMA_event_t event))
 {
 	struct DAC_config dacConf;
 	struct DMA_config dmaConf;
 	struct TIMER_config timConf;
 	
-	uint32_t timercount;
-	uint32_t timerprescalar;
-	
 	//disable all peripheral to make changes
 	TIMER_disable(TIM6);
 	DMA_disable(DMA_CHN);
 	DAC_disable(DAC_CHN);
+	DAC_disable(DAC_CHN2);
 	
 
 	/* Initialize DAC */
@@ -165,35 +409,44 @@ static void ConfigureDAC(uint32_t noofsample, uint32_t periodinns)
 	
 	DAC_init(DAC_CHN, dacConf);
 	DAC_enable(DAC_CHN);
+
+	//channel 2 takes its half of each dual word on the same trigger
+	if(format==OUTPUT_DUAL)
+	{
+		dacConf.dma = DAC_DMA_DISABLE;
+		DAC_init(DAC_CHN2, dacConf);
+		DAC_enable(DAC_CHN2);
+	}
 	
 	/* Initialize DMA */
 	dmaConf.numWrite = noofsample;
-	dmaConf.readMem = DMAData;
-	dmaConf.writeMem = (uint32_t *)(&DAC->DHR12R1);
+	dmaConf.readMem = pTable;
+	//DAC registers only take word accesses, DMA zero extends the sample
+	switch(format)
+	{
+		case OUTPUT_DUAL:
+			dmaConf.writeMem = (uint32_t *)(&DUAL_DAC_REGISTER);
+			dmaConf.memSize = DUAL_DMA_SIZE;
+		break;
+		case OUTPUT_LEFT16:
+			dmaConf.writeMem = (uint32_t *)(&DAC->DHR12L1);
+			dmaConf.memSize = DMA_SIZE_16;
+		break;
+		default:
+			dmaConf.writeMem = (uint32_t *)(&SAMPLE_DAC_REGISTER);
+			dmaConf.memSize = SAMPLE_DMA_SIZE;
+		break;
+	}
+	dmaConf.periphSize = DMA_SIZE_32;
+	dmaConf.circular = true;
+	dmaConf.intEnable = true;
 
-	DMA_init(DMA_CHN, dmaConf);
+	DMA_init(DMA_CHN, dmaConf, callback);
 	DMA_enable(DMA_CHN);
 
 	/* Initialize Timer */
-	
-	timerprescalar=1;
-	//prescalar and count calculation
-	while(1)
-	{
-		timercount=periodinns/(TIMER_TICK_NS*(timerprescalar+1));
-		if(timercount>65535)
-		{
-			timerprescalar=timerprescalar*2;
-		}
-		else
-		{
-			break;
-		}
-	}
-	
-	
 	timConf.count = timercount;
-	timConf.prescale = timerprescalar;
+	timConf.prescale = timerprescale;
 	timConf.mode = TIMER_MODE_CONTINUOUS;
 	timConf.mmode = TIMER_MASTERMODE_UPDATE;
 	timConf.UGInt = TIMER_UGINTERRUPT_DISABLE;
@@ -203,32 +456,275 @@ static void ConfigureDAC(uint32_t noofsample, uint32_t periodinns)
 	TIMER_enable(TIM6);
 }
 
-static void DrawWaveform(enum WAVEFORM_TYPES waveform_types, uint32_t amplitude_in_resolution, uint32_t timing_ns,	uint32_t noOfSample)
+/* A sample period too short for the switch interrupt to move the DMA on
+ * in time, high speed mode only */
+static uint8_t IsFastTiming(const struct WAVEFORM_TIMING* pTiming)
 {
-	GenerateWaveFormTable(waveform_types,noOfSample,amplitude_in_resolution);
-	ConfigureDAC(noOfSample, timing_ns);
+	return (uint32_t)(pTiming->timerCount+1)*(pTiming->timerPrescale+1)<
+		(uint32_t)((uint64_t)SystemCoreClock*DAC_SAMPLE_WAIT_TIME_NS/1000000000);
 }
 
-void GenerateWaveform(enum WAVEFORM_TYPES waveform_types, uint32_t frequency, float amplitude)
+static uint8_t DrawWaveform(enum WAVEFORM_TYPES waveform_types, uint32_t amplitude_in_resolution, struct WAVEFORM_TIMING* pTiming)
 {
-	uint32_t timing_ns;
-	uint32_t noOfSample;
-	uint32_t amplitude_in_resolution;
+	const sample_t* pTable;
+	const void* pPlay;
+
+	SettleSwitch();
+	pTable = Cache_GetTable(waveform_types,pTiming->noOfSample,amplitude_in_resolution);
+	if(pTable==NULL)
+		return 0;
+
+	/* Same table, only the sample period changes. TIM6 reload and prescaler
+	 * are preloaded and take over at the next update, the DMA carries on
+	 * where it is and the output keeps its phase. If the update falls
+	 * between the two writes one sample has the old prescaler. */
+	if(OutputRunning&&DualMode==WAVEGEN_DUAL_OFF&&pTable==HeldTable)
+	{
+		if(TIM6->PSC!=pTiming->timerPrescale)
+			TIMER_setPrescaler(TIM6, pTiming->timerPrescale);
+		TIMER_setCount(TIM6, pTiming->timerCount);
+		ActiveFast = IsFastTiming(pTiming);
+		return 1;
+	}
+
+	//a packed copy is played and held in dual mode, not the cached table
+	if(DualMode!=WAVEGEN_DUAL_OFF)
+	{
+		pPlay = PackDualTable(pTable,pTiming->noOfSample,amplitude_in_resolution);
+		if(pPlay==NULL)
+			return 0;
+	}
+	else
+	{
+		Cache_Lock(pTable);
+		pPlay = pTable;
+	}
+
+	if(OutputRunning&&SwitchMode!=WAVEGEN_SWITCH_RESTART&&!ActiveFast&&!IsFastTiming(pTiming))
+	{
+		RequestSwitch(pPlay,pTiming->noOfSample,pTiming->timerCount,pTiming->timerPrescale);
+		NextLocked = 1;
+	}
+	else
+	{
+		ConfigureDAC(pPlay,pTiming->noOfSample,pTiming->timerCount,pTiming->timerPrescale,(DualMode!=WAVEGEN_DUAL_OFF)?OUTPUT_DUAL:OUTPUT_SAMPLE,&SwitchBuffer);
+		Cache_Unlock(HeldTable);
+		HeldTable = pPlay;
+		ActiveNoOfSample = pTiming->noOfSample;
+		ActiveFast = IsFastTiming(pTiming);
+		OutputRunning = 1;
+	}
+
+	return 1;
+}
+
+static void StopTableOutput(void)
+{
+	SettleSwitch();
+	TIMER_disable(TIM6);
+	Cache_Unlock(HeldTable);
+	HeldTable = NULL;
+	OutputRunning = 0;
+	ActualFrequency = 0;
+}
+
+uint32_t GenerateWaveformMilliHz(enum WAVEFORM_TYPES waveform_types, uint32_t frequency_mhz, float amplitude)
+{
+	struct WAVEFORM_TIMING timing;
+
+	StopSweep();
+	StopBurst();
+	StopBuiltinWave();
+	StopRunLength();
+	StopSequence();
+
+	//squares the DAC cannot make come from the PWM pin, which keeps
+	//running through a retune
+	if(waveform_types==WAVEFORM_TYPE_SQUARE&&frequency_mhz>DACMaxFrequency()*1000)
+	{
+		if(Engine==WAVEGEN_ENGINE_DDS)
+			DDS_Stop();
+		else
+			StopTableOutput();
+
+		if(amplitude>MAX_AMPLITUDE_FLOAT||amplitude<MIN_AMPLITUDE_FLOAT||frequency_mhz>PWM_MAX_FREQUENCY*1000ull)
+		{
+			PWM_Stop();
+			ActualFrequency = 0;
+		}
+		else
+		{
+			ActualFrequency = PWM_Generate(frequency_mhz);
+		}
+		return ActualFrequency;
+	}
+	PWM_Stop();
 	
-	if(ProcessWaveformParam(waveform_types, frequency, amplitude, &timing_ns, &noOfSample))
+	if(Engine==WAVEGEN_ENGINE_DDS)
 	{
-		amplitude_in_resolution = amplitude*DAC_RESOLUTION/DAC_VREF;
-		DrawWaveform(waveform_types,amplitude_in_resolution,timing_ns,noOfSample);
+		if(amplitude>MAX_AMPLITUDE_FLOAT||amplitude<MIN_AMPLITUDE_FLOAT||frequency_mhz==0||frequency_mhz>DDS_MAX_FREQUENCY*1000||
+			(waveform_types==WAVEFORM_TYPE_ARBITRARY&&GetUploadLength()==0))
+		{
+			DDS_Stop();
+			ActualFrequency = 0;
+		}
+		else
+		{
+			ActualFrequency = DDS_Generate(waveform_types,frequency_mhz,AmplitudeToResolution(amplitude));
+		}
+		return ActualFrequency;
+	}
+	
+	if(frequency_mhz>0&&ProcessWaveformParam(waveform_types, frequency_mhz, amplitude, &timing)&&
+		DrawWaveform(waveform_types,AmplitudeToResolution(amplitude),&timing))
+	{
+		ActualFrequency = timing.frequency_mhz;
 	}
 	else
 	{
-		TIMER_disable(TIM6);
+		StopTableOutput();
 	}
+
+	return ActualFrequency;
+}
+
+void GenerateWaveform(enum WAVEFORM_TYPES waveform_types, uint32_t frequency, float amplitude)
+{
+	GenerateWaveformMilliHz(waveform_types,frequency*1000,amplitude);
+}
+
+/* Builds the table GenerateWaveform would play for the parameters without
+ * touching the output, so a later switch to them finds it cached. Meant
+ * for idle time, it only fills free cache room and evicts nothing.
+ * Returns 0 if there is nothing to build ahead or no room for it. */
+uint8_t PrecomputeWaveform(enum WAVEFORM_TYPES waveform_types, uint32_t frequency, float amplitude)
+{
+	struct WAVEFORM_TIMING timing;
+
+	//the other engines and the PWM path have no table to prepare
+	if(Engine!=WAVEGEN_ENGINE_TABLE||frequency==0||
+		(waveform_types==WAVEFORM_TYPE_SQUARE&&frequency>DACMaxFrequency()))
+		return 0;
+
+	if(!ProcessWaveformParam(waveform_types,frequency*1000,amplitude,&timing))
+		return 0;
+
+	return Cache_Prefetch(waveform_types,timing.noOfSample,AmplitudeToResolution(amplitude));
+}
+
+uint32_t GetActualFrequencyMilliHz(void)
+{
+	return ActualFrequency;
+}
+
+/* Stops whichever engine is playing, the next GenerateWaveform starts
+ * it again from scratch */
+void StopOutput(void)
+{
+	StopSweep();
+	StopBurst();
+	StopBuiltinWave();
+	StopRunLength();
+	StopSequence();
+	PWM_Stop();
+	if(Engine==WAVEGEN_ENGINE_DDS)
+		DDS_Stop();
+	else
+		StopTableOutput();
+
+	ActualFrequency = 0;
+}
+
+void SetEngine(enum WAVEGEN_ENGINES engine)
+{
+	if(engine==Engine)
+		return;
+
+	StopOutput();
+	Engine = engine;
+}
+
+enum WAVEGEN_ENGINES GetEngine(void)
+{
+	return Engine;
+}
+
+void SetSwitchMode(enum WAVEGEN_SWITCH_MODES switch_mode)
+{
+	SwitchMode = switch_mode;
+}
+
+enum WAVEGEN_SWITCH_MODES GetSwitchMode(void)
+{
+	return SwitchMode;
+}
+
+/* Modulates the DDS engine output by a waveform_types shape at rate_mhz.
+ * Takes effect straight away if the DDS engine is playing, the table
+ * engine ignores it. */
+uint8_t SetModulation(enum WAVEGEN_MODULATIONS modulation, enum WAVEFORM_TYPES waveform_types, uint32_t rate_mhz, uint32_t depth)
+{
+	if(rate_mhz>DDS_MAX_FREQUENCY*1000||
+		(modulation==WAVEGEN_MODULATION_AM&&depth>100)||
+		(modulation==WAVEGEN_MODULATION_FM&&depth>DDS_MAX_FREQUENCY)||
+		(waveform_types==WAVEFORM_TYPE_ARBITRARY&&GetUploadLength()==0))
+		return 0;
+
+	if(!DDS_SetModulation(modulation,waveform_types,rate_mhz,depth))
+		return 0;
+
+	CurrentModulation = modulation;
+	return 1;
+}
+
+enum WAVEGEN_MODULATIONS GetModulation(void)
+{
+	return CurrentModulation;
+}
+
+/* Turning dual output on or off stops the table engine, the next
+ * GenerateWaveform restarts it. A new phase offset applies from the next
+ * GenerateWaveform. */
+void SetDualMode(enum WAVEGEN_DUAL_MODES dual_mode, uint32_t phase_degree)
+{
+	if((dual_mode==WAVEGEN_DUAL_OFF)!=(DualMode==WAVEGEN_DUAL_OFF)&&Engine==WAVEGEN_ENGINE_TABLE)
+		StopTableOutput();
+
+	DualMode = dual_mode;
+	DualPhase = phase_degree%360;
+}
+
+enum WAVEGEN_DUAL_MODES GetDualMode(void)
+{
+	return DualMode;
+}
+
+/* Highest frequency GenerateWaveform reaches for the type in the current
+ * engine and speed mode, squares beyond the DAC come from the PWM pin */
+uint32_t GetMaxFreq(enum WAVEFORM_TYPES waveform_types)
+{
+		if(waveform_types==WAVEFORM_TYPE_SQUARE)
+			return PWM_MAX_FREQUENCY;
+		return DACMaxFrequency();
+}
+
+/* High speed mode trades samples per cycle for frequency on the table
+ * engine, min_sample is the floor, HIGH_SPEED_MIN_SAMPLE to
+ * MIN_SAMPLE_PER_CYCLE. Applies from the next GenerateWaveform. */
+uint8_t SetSpeedMode(enum WAVEGEN_SPEED_MODES speed_mode, uint32_t min_sample)
+{
+	if(speed_mode==WAVEGEN_SPEED_HIGH&&(min_sample<HIGH_SPEED_MIN_SAMPLE||min_sample>MIN_SAMPLE_PER_CYCLE))
+		return 0;
+
+	SpeedMode = speed_mode;
+	if(speed_mode==WAVEGEN_SPEED_HIGH)
+		SampleFloor = min_sample;
+	return 1;
 }
 
-uint32_t GetMaxFreq(void)
+enum WAVEGEN_SPEED_MODES GetSpeedMode(void)
 {
-		return MAX_FREQUENCY;
+	return SpeedMode;
 }
 
 uint32_t GetMinFreq(void)
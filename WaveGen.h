@@ -1,17 +1,28 @@
+#ifndef WAVEGEN_H
+#define WAVEGEN_H
+
 #include "DAC_DRV.h"
 #include "DMA_DRV.h"
 #include "TIMER_DRV.h"
 
 
 #define DAC_CHN			1
+#define DAC_CHN2		2
 #define DMA_CHN			3
-
-#define TIMER_TICK_NS		21
-#define CLOCK_SPEED			42000000
+//requested by TIM7 updates
+#define SWEEP_DMA_CHN	4
+//requested by DAC channel 2 on TIM6 updates, shared with the sweep
+#define RUNLENGTH_DMA_CHN	4
 
 #define DAC_RESOLUTION 4096
 #define DAC_VREF				3.3
 
+/* Width of a stored sample: 16 streams 12 bit codes into DHR12R1,
+ * 8 streams the upper 8 bits into DHR8R1 */
+#ifndef WAVEGEN_SAMPLE_BITS
+#define WAVEGEN_SAMPLE_BITS		16
+#endif
+
 
 
 enum WAVEFORM_TYPES
@@ -19,11 +30,112 @@ enum WAVEFORM_TYPES
 	WAVEFORM_TYPE_SINE=0,
 	WAVEFORM_TYPE_SAWTOOTH,
 	WAVEFORM_TYPE_TRIANGULAR,
-	WAVEFORM_TYPE_SQUARE
+	WAVEFORM_TYPE_SQUARE,
+	WAVEFORM_TYPE_ARBITRARY		//last shape sent with UploadWaveform
+};
+
+/* Engine behind GenerateWaveform */
+enum WAVEGEN_ENGINES
+{
+	WAVEGEN_ENGINE_TABLE=0,		//one cycle per table, frequency set by TIM6
+	WAVEGEN_ENGINE_DDS			//fixed sample rate, phase accumulator
+};
+
+/* Samples per cycle against frequency on the table engine */
+enum WAVEGEN_SPEED_MODES
+{
+	WAVEGEN_SPEED_NORMAL=0,		//MIN_SAMPLE_PER_CYCLE at DAC_SAMPLE_WAIT_TIME_NS
+	WAVEGEN_SPEED_HIGH			//down to the floor at DAC_FAST_SAMPLE_WAIT_TIME_NS
+};
+
+/* How a running output moves to a new waveform */
+enum WAVEGEN_SWITCH_MODES
+{
+	WAVEGEN_SWITCH_RESTART=0,	//stop the output, rewrite and restart, a retune of the same table never stops
+	WAVEGEN_SWITCH_CYCLE,		//double buffered, switch at the end of a cycle
+	WAVEGEN_SWITCH_PHASE		//double buffered, switch at half cycle at the same phase
+};
+
+/* Second output on DAC channel 2 (PA5), table engine only. Both channels
+ * are written through the dual register by the same DMA transfer and
+ * update on the same TIM6 trigger. */
+enum WAVEGEN_DUAL_MODES
+{
+	WAVEGEN_DUAL_OFF=0,			//channel 1 only
+	WAVEGEN_DUAL_PHASE,			//channel 2 leads channel 1 by the phase offset
+	WAVEGEN_DUAL_QUADRATURE,	//channel 2 leads by 90 degrees, I on 2 and Q on 1
+	WAVEGEN_DUAL_COMPLEMENT		//channel 2 is the amplitude minus channel 1
+};
+
+/* Modulation of the DDS engine output */
+enum WAVEGEN_MODULATIONS
+{
+	WAVEGEN_MODULATION_NONE=0,
+	WAVEGEN_MODULATION_AM,		//depth in percent, 0 to 100
+	WAVEGEN_MODULATION_FM		//depth is the peak deviation in hertz
+};
+
+/* What starts an armed burst, TriggerBurst always does */
+enum WAVEGEN_TRIGGERS
+{
+	WAVEGEN_TRIGGER_SOFTWARE=0,	//TriggerBurst only
+	WAVEGEN_TRIGGER_RISING,		//rising edge on BURST_TRIGGER_PIN
+	WAVEGEN_TRIGGER_FALLING		//falling edge on BURST_TRIGGER_PIN
+};
+
+/* Wave generators built into the DAC, see StartBuiltinWave */
+enum WAVEGEN_BUILTIN_WAVES
+{
+	WAVEGEN_BUILTIN_TRIANGLE=0,
+	WAVEGEN_BUILTIN_NOISE		//LFSR white noise, frequency is the update rate
+};
+
+/* Step spacing of StartSweep */
+enum WAVEGEN_SWEEP_SPACINGS
+{
+	WAVEGEN_SWEEP_LINEAR=0,		//equal steps in hertz
+	WAVEGEN_SWEEP_LOG			//equal frequency ratio per step
+};
+
+/* Symbols of KeyWaveform, bit 0 and bit 1 */
+enum WAVEGEN_KEYINGS
+{
+	WAVEGEN_KEYING_FSK=0,		//two tones
+	WAVEGEN_KEYING_BPSK,		//carrier and carrier shifted by 180 degrees
+	WAVEGEN_KEYING_OOK			//middle level and carrier
+};
+
+/* One stage of StartSequence. It lasts cycles whole cycles or, with
+ * cycles 0, the whole number of cycles closest to duration_ms. */
+struct WAVEGEN_SEGMENT
+{
+	enum WAVEFORM_TYPES waveform_types;
+	uint32_t frequency;			//hertz, up to MAX_FREQUENCY
+	float amplitude;
+	uint32_t cycles;
+	uint32_t duration_ms;
+};
+
+/* One entry of the StartRunLength list */
+struct WAVEGEN_RUN
+{
+	uint16_t level;				//12 bit code at full scale
+	uint16_t ticks;				//timer ticks the level is held
+};
+
+/* One entry of the SetHarmonics list */
+struct WAVEGEN_HARMONIC
+{
+	uint16_t number;			//1 is the fundamental
+	uint16_t amplitude;			//relative to the other entries
+	uint16_t phase_degree;		//0 to 359, 0 is sine
 };
 
 #define PI_VALUE 3.14159
 
+#define SINE_QUARTER_BITS		8
+#define SINE_QUARTER_STEPS		(1<<SINE_QUARTER_BITS)
+
 
 #define MAX_AMPLITUDE_DECIMAL_PLACES 
 
@@ -36,11 +148,127 @@ enum WAVEFORM_TYPES
 #define MAX_MEMORY_ALLOWED			2000
 
 #define MAX_FREQUENCY (1000000000/(DAC_SAMPLE_WAIT_TIME_NS*MIN_SAMPLE_PER_CYCLE))
+
+/* High speed mode, 1 MSPS is the DAC's update rate with the output buffer */
+#define DAC_FAST_SAMPLE_WAIT_TIME_NS	1000
+#define HIGH_SPEED_MIN_SAMPLE		8
+#define HIGH_SPEED_DEFAULT_SAMPLE	16
 #define MIN_FREQUENCY 1
 
+/* RAM given to the table cache, at least two full size tables. Dual
+ * tables and other working memory are borrowed from it too. */
+#ifndef WAVEGEN_CACHE_BYTES
+#define WAVEGEN_CACHE_BYTES			8192
+#endif
+#define WAVEGEN_CACHE_ENTRIES		16
+
+/* SRAM of the STM32F072RB less the stack and heap of
+ * startup_stm32f072.s, the large buffers are checked against it in
+ * WaveCache.c with WAVEGEN_RAM_SPARE left for the small ones */
+#define WAVEGEN_RAM_BYTES			(0x4000-0x400-0x600)
+#define WAVEGEN_RAM_SPARE			1024
+
+/* Longest uploaded shape, two are kept so a failed upload changes nothing */
+#define UPLOAD_MAX_SAMPLE			512
+#define UPLOAD_START_TIMEOUT_MS		10000
+#define UPLOAD_TIMEOUT_MS			1000
+
+/* Inverse FFT size of SetHarmonics, the shape goes to the upload buffer */
+#define SPECTRUM_BITS				9
+#define SPECTRUM_SIZE				(1<<SPECTRUM_BITS)
+#define SPECTRUM_MAX_HARMONICS		16
+
+/* Samples per half of the streaming buffer, both halves fit the RX ring */
+#define STREAM_HALF_BUFFER			64
+#define STREAM_START_TIMEOUT_MS		10000
+#define STREAM_IDLE_MS				500
+
+/* Samples per symbol of KeyWaveform, and per carrier cycle at least */
+#define KEYING_MAX_SAMPLE			256
+#define KEYING_MIN_SAMPLE			8
+#define KEYING_START_TIMEOUT_MS		10000
+#define KEYING_IDLE_MS				500
+
+#define SWEEP_MAX_STEPS				256
+
+#define RUNLENGTH_MAX_RUNS			64
+
+#define SEQUENCE_MAX_SEGMENTS		16
+
+/* Square waves above the DAC path, TIM3 channel 1 on PA6 (D12) */
+#define PWM_TIM						TIM3
+#define PWM_PORT					GPIOA
+#define PWM_PIN						6
+#define PWM_AF						1
+//in millihertz it still fits 32 bits
+#define PWM_MAX_FREQUENCY			4000000
+
+/* User button of the Nucleo board */
+#define BURST_TRIGGER_PORT			GPIOC
+#define BURST_TRIGGER_PIN			13
+#define BURST_MAX_CYCLES			65535
+
+/* Packed words per dual table, borrowed from the cache while played */
+#define DUAL_MAX_SAMPLE				256
+
+#define DDS_SAMPLE_RATE				200000
+#define DDS_TABLE_BITS				10
+#define DDS_HALF_BUFFER				128
+#define DDS_MAX_FREQUENCY			(DDS_SAMPLE_RATE/MIN_SAMPLE_PER_CYCLE)
+#define DDS_MOD_TABLE_BITS			8
+
 extern uint8_t IsParameterAllowed(enum WAVEFORM_TYPES waveform_types, uint32_t frequency, float amplitude);
 extern void GenerateWaveform(enum WAVEFORM_TYPES waveform_types, uint32_t frequency, float amplitude);
-extern uint32_t GetMaxFreq(void);
+extern uint8_t PrecomputeWaveform(enum WAVEFORM_TYPES waveform_types, uint32_t frequency, float amplitude);
+extern uint32_t GenerateWaveformMilliHz(enum WAVEFORM_TYPES waveform_types, uint32_t frequency_mhz, float amplitude);
+extern void SetEngine(enum WAVEGEN_ENGINES engine);
+extern enum WAVEGEN_ENGINES GetEngine(void);
+extern uint32_t GetActualFrequencyMilliHz(void);
+extern uint32_t GetCacheHits(void);
+extern uint32_t GetCacheMisses(void);
+extern uint32_t GetMaxFreq(enum WAVEFORM_TYPES waveform_types);
 extern uint32_t GetMinFreq(void);
 extern float GetMaxAmplitude(void);
 extern float GetMinAmplitude(void);
+extern uint8_t SetSpeedMode(enum WAVEGEN_SPEED_MODES speed_mode, uint32_t min_sample);
+extern enum WAVEGEN_SPEED_MODES GetSpeedMode(void);
+extern void SetSwitchMode(enum WAVEGEN_SWITCH_MODES switch_mode);
+extern enum WAVEGEN_SWITCH_MODES GetSwitchMode(void);
+extern void SetDualMode(enum WAVEGEN_DUAL_MODES dual_mode, uint32_t phase_degree);
+extern enum WAVEGEN_DUAL_MODES GetDualMode(void);
+extern uint32_t UploadWaveform(int (*read)(unsigned char* input), unsigned char (*write)(unsigned char output), uint32_t (*millis)(void));
+extern uint32_t GetUploadLength(void);
+extern uint8_t SetHarmonics(const struct WAVEGEN_HARMONIC* pHarmonics, uint32_t count);
+extern uint32_t StreamWaveform(uint32_t sample_rate, uint32_t (*millis)(void));
+extern uint32_t GetStreamMaxRate(void);
+extern uint32_t GetStreamUnderruns(void);
+extern uint32_t GetStreamLevel(void);
+extern uint32_t KeyWaveform(enum WAVEGEN_KEYINGS keying, uint32_t symbol_rate, uint32_t frequency, uint32_t frequency_one,
+	float amplitude, uint32_t (*millis)(void));
+extern uint32_t GetKeyingMaxRate(void);
+extern uint32_t GetKeyingRateMilliHz(void);
+extern uint32_t GetKeyingUnderruns(void);
+extern uint8_t StartSweep(enum WAVEFORM_TYPES waveform_types, uint32_t start_frequency, uint32_t stop_frequency, uint32_t steps,
+	uint32_t dwell_ms, enum WAVEGEN_SWEEP_SPACINGS spacing, float amplitude);
+extern void StopSweep(void);
+extern uint8_t StartSequence(const struct WAVEGEN_SEGMENT* pSegments, uint32_t count, uint8_t loop);
+extern void StopSequence(void);
+extern uint8_t IsSequenceRunning(void);
+extern uint32_t GetSequenceSegment(void);
+extern uint32_t GetSequenceLate(void);
+extern uint32_t StartRunLength(const struct WAVEGEN_RUN* pRuns, uint32_t count, uint32_t prescale, float amplitude);
+extern void StopRunLength(void);
+extern uint32_t StartBuiltinWave(enum WAVEGEN_BUILTIN_WAVES wave, uint32_t frequency_mhz, float amplitude);
+extern void StopBuiltinWave(void);
+extern uint32_t GetBuiltinMaxFreq(enum WAVEGEN_BUILTIN_WAVES wave, float amplitude);
+extern uint8_t SetDutyCycle(uint32_t duty_percent);
+extern uint32_t GetDutyCycle(void);
+extern uint8_t IsPWMOutput(void);
+extern uint8_t ArmBurst(enum WAVEFORM_TYPES waveform_types, uint32_t frequency, float amplitude, uint32_t cycles, enum WAVEGEN_TRIGGERS trigger);
+extern void TriggerBurst(void);
+extern void StopBurst(void);
+extern uint32_t GetBurstCount(void);
+extern uint8_t SetModulation(enum WAVEGEN_MODULATIONS modulation, enum WAVEFORM_TYPES waveform_types, uint32_t rate_mhz, uint32_t depth);
+extern enum WAVEGEN_MODULATIONS GetModulation(void);
+
+#endif
@@ -0,0 +1,126 @@
+#ifndef WAVEGENPRIV_H
+#define WAVEGENPRIV_H
+
+#include "WaveGen.h"
+#include "WaveTables.h"
+
+/* Shared between the waveform engines, not part of the WaveGen API */
+
+#if WAVEGEN_SAMPLE_BITS==16
+typedef uint16_t sample_t;
+#define SAMPLE_SHIFT			0
+#define SAMPLE_DMA_SIZE			DMA_SIZE_16
+#define SAMPLE_DAC_REGISTER		(DAC->DHR12R1)
+typedef uint32_t dual_t;
+#define DUAL_SHIFT				16
+#define DUAL_DMA_SIZE			DMA_SIZE_32
+#define DUAL_DAC_REGISTER		(DAC->DHR12RD)
+#elif WAVEGEN_SAMPLE_BITS==8
+typedef uint8_t sample_t;
+#define SAMPLE_SHIFT			4
+#define SAMPLE_DMA_SIZE			DMA_SIZE_8
+#define SAMPLE_DAC_REGISTER		(DAC->DHR8R1)
+typedef uint16_t dual_t;
+#define DUAL_SHIFT				8
+#define DUAL_DMA_SIZE			DMA_SIZE_16
+#define DUAL_DAC_REGISTER		(DAC->DHR8RD)
+#else
+#error "WAVEGEN_SAMPLE_BITS must be 8 or 16"
+#endif
+
+//converts a 12 bit DAC code to the stored sample width
+#define TO_SAMPLE(code)			((sample_t)((code)>>SAMPLE_SHIFT))
+
+//channel 1 in the low half of a dual register word, channel 2 in the high
+#define TO_DUAL(sample1,sample2)	((dual_t)((sample1)|((dual_t)(sample2)<<DUAL_SHIFT)))
+
+/* Table length and TIM6 setting for a frequency */
+struct WAVEFORM_TIMING
+{
+	uint32_t noOfSample;
+	uint16_t timerCount;
+	uint16_t timerPrescale;
+	uint32_t frequency_mhz;
+	uint32_t error;			//timer ticks per cycle off the request
+};
+
+/* A segment of StartSequence resolved to its table and timing */
+struct SEQUENCE_STEP
+{
+	enum WAVEFORM_TYPES type;
+	uint32_t amplitude;
+	uint32_t noOfSample;
+	uint16_t timerCount;
+	uint16_t timerPrescale;
+	uint32_t cycles;
+};
+
+/* Working memory of the engines that play on their own. Each one starts
+ * with StopOutput, so none of the others is using it, and owns it until
+ * stopped. The table engine and SetHarmonics borrow from the cache
+ * instead, they run alongside the others. */
+#define ENGINE_MEMORY_BYTES		512
+
+union ENGINE_MEMORY
+{
+	uint32_t words[ENGINE_MEMORY_BYTES/4];
+	sample_t dds[2*DDS_HALF_BUFFER];				//WaveDDS.c
+	uint16_t sweepReload[SWEEP_MAX_STEPS];			//WaveSweep.c
+	uint16_t stream[2*STREAM_HALF_BUFFER];			//WaveStream.c
+	struct
+	{
+		sample_t level[RUNLENGTH_MAX_RUNS];
+		uint16_t reload[RUNLENGTH_MAX_RUNS];
+	} runLength;									//WaveRunLength.c
+	struct SEQUENCE_STEP sequence[SEQUENCE_MAX_SEGMENTS];	//WaveSequence.c
+};
+
+extern union ENGINE_MEMORY EngineMemory;
+
+/* What the DMA feeds the DAC with */
+enum OUTPUT_FORMATS
+{
+	OUTPUT_SAMPLE=0,		//sample_t into SAMPLE_DAC_REGISTER
+	OUTPUT_DUAL,			//dual_t into DUAL_DAC_REGISTER, channel 2 alongside
+	OUTPUT_LEFT16			//uint16_t into DHR12L1, the top 12 bits are converted
+};
+
+extern void GenerateWaveFormTable(sample_t* pTable, enum WAVEFORM_TYPES waveform_types, uint32_t NoOfSample, uint32_t Amplitude_In_Resolution);
+extern void ScaleWaveFormTable(sample_t* pTable, const sample_t* pSource, uint32_t NoOfSample, uint32_t Old_Amplitude, uint32_t New_Amplitude);
+extern void ConfigureDAC(const void* pTable, uint32_t noofsample, uint16_t timercount, uint16_t timerprescale, enum OUTPUT_FORMATS format, void (*callback)(DMA_event_t event));
+extern void StopOutput(void);
+extern uint32_t AmplitudeToResolution(float amplitude);
+extern uint32_t MaxSamplePerCycle(uint32_t frequency_mhz);
+extern uint8_t SolveTiming(uint32_t frequency_mhz, uint32_t minSample, uint32_t maxSample, uint8_t powerOfTwo, struct WAVEFORM_TIMING* pTiming);
+extern uint8_t ProcessWaveformParam(enum WAVEFORM_TYPES waveform_types, uint32_t frequency_mhz, float amplitude, struct WAVEFORM_TIMING* pTiming);
+extern int32_t SineQ15(uint32_t phase);
+
+/* WaveCache.c */
+extern const sample_t* Cache_GetTable(enum WAVEFORM_TYPES waveform_types, uint32_t NoOfSample, uint32_t Amplitude_In_Resolution);
+extern void* Cache_Borrow(uint32_t bytes);
+extern void Cache_Lock(const void* pTable);
+extern void Cache_Unlock(const void* pTable);
+extern void Cache_Forget(enum WAVEFORM_TYPES waveform_types);
+extern uint8_t Cache_Prefetch(enum WAVEFORM_TYPES waveform_types, uint32_t NoOfSample, uint32_t Amplitude_In_Resolution);
+extern uint8_t Cache_TryEnter(void);
+extern void Cache_Leave(void);
+
+/* WaveTables.c, generated by tools/gen_wavetables.py */
+extern const sample_t* const FlashTables[FLASH_TABLE_SHAPES][FLASH_TABLE_MAX_BITS-FLASH_TABLE_MIN_BITS+1];
+extern const sample_t* const BandLimitTables[FLASH_BANDLIMIT_SHAPES][FLASH_BANDLIMIT_LEVELS];
+
+/* WaveUpload.c */
+extern void GenerateArbitraryTable(sample_t* pTable, uint32_t NoOfSample, uint32_t Amplitude_In_Resolution);
+extern uint16_t* Upload_SpareShape(void);
+extern void Upload_Commit(uint32_t length);
+
+/* WavePWM.c */
+extern uint32_t PWM_Generate(uint32_t frequency_mhz);
+extern void PWM_Stop(void);
+
+/* WaveDDS.c */
+extern uint32_t DDS_Generate(enum WAVEFORM_TYPES waveform_types, uint32_t frequency_mhz, uint32_t amplitude_in_resolution);
+extern void DDS_Stop(void);
+extern uint8_t DDS_SetModulation(enum WAVEGEN_MODULATIONS modulation, enum WAVEFORM_TYPES waveform_types, uint32_t rate_mhz, uint32_t depth);
+
+#endif
@@ -0,0 +1,281 @@
+#include "WaveGenPriv.h"
+#include "Serial.h"
+
+
+/* FSK, BPSK and OOK keyed by a bitstream from the serial port, the most
+ * significant bit of every byte first. Each symbol is a table of exactly
+ * KeyingSamples samples holding a whole number of sine cycles, so every
+ * symbol starts and ends at phase 0:
+ *	FSK:  0 and 1 are the two tones, the phase runs on across a change
+ *	BPSK: 1 is the carrier of 0 shifted by 180 degrees
+ *	OOK:  0 holds the middle level, 1 is the carrier
+ * The carriers are rounded to whole multiples of the symbol rate.
+ *
+ * The DMA plays the table of the current symbol in a loop. The half
+ * transfer interrupt takes the next bit and the transfer complete
+ * interrupt points the DMA at its table. The new source only has to be in
+ * place by the next TIM6 trigger, a sample at the normal DAC rate later,
+ * so every symbol lasts exactly KeyingSamples triggers and the boundaries
+ * sit on timer ticks whatever the serial line does.
+ *
+ * After every byte taken the fill level of the RX ring buffer goes back to
+ * the host as a single byte in percent, as for streaming. KeyWaveform sends
+ * it while it waits, a full TX ring must not hold up the interrupt. The
+ * symbol tables are borrowed from the table cache. A symbol with no
+ * bit waiting plays symbol 0 and counts as an underrun once more data
+ * follows, the end of the stream does not count. */
+
+//start, 8 data and stop bits
+#define KEYING_BITS_PER_BYTE		10
+
+static sample_t* KeyingTable[2];
+static uint32_t KeyingSamples;
+static uint32_t KeyingRate;
+
+static const sample_t* PlayingSource;
+static const sample_t* NextSource;
+static uint8_t KeyingByte;
+static uint32_t KeyingBits;
+
+static volatile uint32_t KeyedSymbols;
+static volatile uint32_t KeyingUnderruns;
+static uint32_t PendingUnderruns;
+//RX fill level waiting to be sent, 0xFF once sent
+static volatile uint8_t KeyingLevel;
+
+//c whole cycles over the symbol, phase in 2^32 per turn
+static void Keying_Carrier(sample_t* pTable, uint32_t cycles, uint32_t phase, uint32_t amplitude_in_resolution)
+{
+	uint32_t i;
+
+	for(i=0;i<KeyingSamples;i++)
+	{
+		pTable[i]=TO_SAMPLE(((uint32_t)(SineQ15(phase+(uint32_t)(((uint64_t)i*cycles<<32)/KeyingSamples))+32768)*
+			(amplitude_in_resolution+1))>>16);
+	}
+}
+
+static void Keying_NextBit(void)
+{
+	unsigned char input;
+
+	if(KeyingBits==0)
+	{
+		if(SER_GetChar_nonBlocking(&input))
+		{
+			NextSource = KeyingTable[0];
+			PendingUnderruns++;
+			return;
+		}
+
+		KeyingUnderruns += PendingUnderruns;
+		PendingUnderruns = 0;
+		KeyingByte = input;
+		KeyingBits = 8;
+		KeyingLevel = SER_Available()*100/(SER_RBUF_SIZE-1);
+	}
+
+	KeyingBits--;
+	NextSource = KeyingTable[(KeyingByte>>KeyingBits)&1];
+	KeyedSymbols++;
+}
+
+static void Keying_Symbol(DMA_event_t event)
+{
+	if(event==DMA_EVENT_HALF_TRANSFER)
+	{
+		Keying_NextBit();
+	}
+	else if(event==DMA_EVENT_TRANSFER_COMPLETE)
+	{
+		//the last sample of the symbol is in the DAC, the next trigger takes the new source
+		if(NextSource!=PlayingSource)
+		{
+			DMA_setSource(DMA_CHN, NextSource, KeyingSamples);
+			PlayingSource = NextSource;
+		}
+	}
+}
+
+/* Splits a symbol into the most samples at or above the normal DAC time
+ * that gives its length in whole timer ticks, or closest to it. Returns
+ * the sample time in ticks, 0 if the symbol is too short. */
+static uint32_t Keying_Samples(uint32_t symbol_rate)
+{
+	uint32_t symbol_ticks;
+	uint32_t min_ticks;
+	uint32_t samples;
+	uint32_t ticks;
+	uint32_t error;
+	uint32_t best_error;
+	uint32_t best_ticks;
+
+	symbol_ticks = (SystemCoreClock+symbol_rate/2)/symbol_rate;
+	min_ticks = (uint32_t)(((uint64_t)SystemCoreClock*DAC_SAMPLE_WAIT_TIME_NS+999999999)/1000000000);
+
+	samples = symbol_ticks/min_ticks;
+	if(samples>KEYING_MAX_SAMPLE)
+		samples = KEYING_MAX_SAMPLE;
+
+	best_error = 0xFFFFFFFF;
+	best_ticks = 0;
+	for(;samples>=KEYING_MIN_SAMPLE;samples--)
+	{
+		ticks = (symbol_ticks+samples/2)/samples;
+		error = (samples*ticks>symbol_ticks)?samples*ticks-symbol_ticks:symbol_ticks-samples*ticks;
+		if(error<best_error)
+		{
+			best_error = error;
+			best_ticks = ticks;
+			KeyingSamples = samples;
+			if(error==0)
+				break;
+		}
+	}
+
+	return best_ticks;
+}
+
+//sine cycles per symbol closest to the frequency, 0 if too few samples per cycle
+static uint32_t Keying_Cycles(uint32_t frequency)
+{
+	uint32_t cycles;
+
+	cycles = (uint32_t)(((uint64_t)frequency*1000+KeyingRate/2)/KeyingRate);
+	if(cycles==0||cycles>KeyingSamples/KEYING_MIN_SAMPLE)
+		return 0;
+	return cycles;
+}
+
+/* Keys the carrier at symbol_rate until the host stops sending for
+ * KEYING_IDLE_MS. frequency is the carrier, for FSK the tone of 0 and
+ * frequency_one the tone of 1. Waits up to KEYING_START_TIMEOUT_MS for the
+ * first byte. Returns the number of symbols played, 0 if a setting is out
+ * of range or nothing arrived. Whatever was playing is stopped. */
+uint32_t KeyWaveform(enum WAVEGEN_KEYINGS keying, uint32_t symbol_rate, uint32_t frequency, uint32_t frequency_one,
+	float amplitude, uint32_t (*millis)(void))
+{
+	uint32_t amplitude_in_resolution;
+	uint32_t cycles;
+	uint32_t cycles_one;
+	uint32_t ticks;
+	uint32_t prescale;
+	uint32_t last;
+	uint32_t start;
+	uint32_t seen;
+	uint32_t i;
+	uint8_t level;
+
+	if(symbol_rate==0||symbol_rate>GetKeyingMaxRate()||
+		amplitude>MAX_AMPLITUDE_FLOAT||amplitude<MIN_AMPLITUDE_FLOAT)
+		return 0;
+
+	ticks = Keying_Samples(symbol_rate);
+	if(ticks==0)
+		return 0;
+	prescale = (ticks-1)>>16;
+	ticks = (ticks+(prescale+1)/2)/(prescale+1);
+	KeyingRate = (uint32_t)(((uint64_t)SystemCoreClock*1000+(uint64_t)KeyingSamples*ticks*(prescale+1)/2)/
+		((uint64_t)KeyingSamples*ticks*(prescale+1)));
+
+	cycles = Keying_Cycles(frequency);
+	cycles_one = (keying==WAVEGEN_KEYING_FSK)?Keying_Cycles(frequency_one):cycles;
+	if(cycles==0||cycles_one==0||(keying==WAVEGEN_KEYING_FSK&&cycles==cycles_one))
+		return 0;
+
+	StopOutput();
+
+	//nothing is locked once stopped, so there is room
+	KeyingTable[0] = Cache_Borrow(2*KeyingSamples*sizeof(sample_t));
+	if(KeyingTable[0]==NULL)
+		return 0;
+	KeyingTable[1] = KeyingTable[0]+KeyingSamples;
+
+	amplitude_in_resolution = AmplitudeToResolution(amplitude);
+	switch(keying)
+	{
+		case WAVEGEN_KEYING_FSK:
+			Keying_Carrier(KeyingTable[0],cycles,0,amplitude_in_resolution);
+			Keying_Carrier(KeyingTable[1],cycles_one,0,amplitude_in_resolution);
+		break;
+		case WAVEGEN_KEYING_BPSK:
+			Keying_Carrier(KeyingTable[0],cycles,0,amplitude_in_resolution);
+			Keying_Carrier(KeyingTable[1],cycles,0x80000000,amplitude_in_resolution);
+		break;
+		default:
+			for(i=0;i<KeyingSamples;i++)
+				KeyingTable[0][i]=TO_SAMPLE(amplitude_in_resolution/2);
+			Keying_Carrier(KeyingTable[1],cycles,0,amplitude_in_resolution);
+		break;
+	}
+
+	KeyedSymbols = 0;
+	KeyingUnderruns = 0;
+	PendingUnderruns = 0;
+	KeyingBits = 0;
+	KeyingLevel = 0xFF;
+
+	start = millis();
+	while(SER_Available()==0)
+	{
+		if(millis()-start>KEYING_START_TIMEOUT_MS)
+		{
+			Cache_Unlock(KeyingTable[0]);
+			return 0;
+		}
+	}
+	Keying_NextBit();
+	PlayingSource = NextSource;
+
+	ConfigureDAC(PlayingSource,KeyingSamples,ticks-1,prescale,OUTPUT_SAMPLE,&Keying_Symbol);
+	DMA_enableInterrupt(DMA_CHN, DMA_EVENT_HALF_TRANSFER);
+	DMA_enableInterrupt(DMA_CHN, DMA_EVENT_TRANSFER_COMPLETE);
+
+	seen = KeyedSymbols;
+	last = millis();
+	while(millis()-last<=KEYING_IDLE_MS)
+	{
+		level = KeyingLevel;
+		if(level!=0xFF)
+		{
+			KeyingLevel = 0xFF;
+			SER_PutChar(level);
+		}
+		if(KeyedSymbols!=seen)
+		{
+			seen = KeyedSymbols;
+			last = millis();
+		}
+	}
+
+	TIMER_disable(TIM6);
+	DMA_disableInterrupt(DMA_CHN, DMA_EVENT_HALF_TRANSFER);
+	DMA_disableInterrupt(DMA_CHN, DMA_EVENT_TRANSFER_COMPLETE);
+	Cache_Unlock(KeyingTable[0]);
+
+	return KeyedSymbols;
+}
+
+/* Symbol rate the serial line and the DAC can keep up with */
+uint32_t GetKeyingMaxRate(void)
+{
+	uint32_t line;
+	uint32_t dac;
+
+	line = SER_BAUDRATE*8/KEYING_BITS_PER_BYTE;
+	dac = 1000000000/(DAC_SAMPLE_WAIT_TIME_NS*KEYING_MIN_SAMPLE);
+
+	return (line<dac)?line:dac;
+}
+
+/* Symbol rate of the last KeyWaveform in millihertz, the carriers are
+ * whole multiples of it */
+uint32_t GetKeyingRateMilliHz(void)
+{
+	return KeyingRate;
+}
+
+uint32_t GetKeyingUnderruns(void)
+{
+	return KeyingUnderruns;
+}
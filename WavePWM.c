@@ -0,0 +1,107 @@
+#include "WaveGenPriv.h"
+#include "GPIO_DRV.h"
+
+
+/* Square waves above the DAC path come from channel 1 of PWM_TIM on
+ * PWM_PORT pin PWM_PIN instead of the DAC output. The timer drives the pin
+ * by itself, no DMA or interrupt is involved. Reload, prescaler and compare
+ * are all buffered, so a retune lands at the end of a period without a
+ * glitch and the output keeps running across frequency changes.
+ *
+ * The duty cycle resolves to 1/(reload+1) of the period, which gets coarse
+ * in the MHz range: a twelfth at PWM_MAX_FREQUENCY. The amplitude is the
+ * logic level of the pin. */
+
+static uint32_t PWMDuty = 50;
+static uint32_t PWMFrequency;
+static uint8_t PWMRunning;
+
+/* Returns the frequency produced in millihertz, 0 if it cannot be made */
+uint32_t PWM_Generate(uint32_t frequency_mhz)
+{
+	struct TIMER_pwmConfig pwmConf;
+	struct GPIO_config gpioConf;
+	uint64_t ticks;
+	uint32_t prescale;
+	uint32_t period;
+	uint32_t compare;
+
+	if(frequency_mhz==0)
+		return 0;
+
+	ticks = ((uint64_t)SystemCoreClock*1000+frequency_mhz/2)/frequency_mhz;
+	if(ticks<2)
+		return 0;
+	prescale = (uint32_t)((ticks-1)>>16);
+	if(prescale>0xFFFF)
+		return 0;
+	period = (uint32_t)((ticks+(prescale+1)/2)/(prescale+1));
+
+	//keep both levels however coarse the steps are
+	compare = (period*PWMDuty+50)/100;
+	if(compare<1)
+		compare = 1;
+	if(compare>period-1)
+		compare = period-1;
+
+	pwmConf.count = period-1;
+	pwmConf.prescale = prescale;
+	pwmConf.compare = compare;
+
+	if(PWMRunning)
+	{
+		TIMER_setPWM(PWM_TIM, pwmConf);
+	}
+	else
+	{
+		TIMER_initPWM(PWM_TIM, pwmConf);
+
+		gpioConf.dir = GPIO_DIR_ALTERNATE;
+		gpioConf.outType = GPIO_OUTTYPE_PUSHPULL;
+		gpioConf.speed = GPIO_SPEED_FAST;
+		gpioConf.pullRes = GPIO_PULLRES_DISABLED;
+
+		GPIO_initPin(PWM_PORT, PWM_PIN, gpioConf);
+		GPIO_setAltFunc(PWM_PORT, PWM_PIN, PWM_AF);
+		TIMER_enable(PWM_TIM);
+		PWMRunning = 1;
+	}
+
+	PWMFrequency = frequency_mhz;
+	return (uint32_t)(((uint64_t)SystemCoreClock*1000+(uint64_t)period*(prescale+1)/2)/((uint64_t)period*(prescale+1)));
+}
+
+/* The pin is driven low while stopped */
+void PWM_Stop(void)
+{
+	if(!PWMRunning)
+		return;
+
+	GPIO_writePin(PWM_PORT, PWM_PIN, GPIO_OUTVAL_LOW);
+	GPIO_setDir(PWM_PORT, PWM_PIN, GPIO_DIR_OUTPUT);
+	TIMER_disable(PWM_TIM);
+	PWMRunning = 0;
+}
+
+uint8_t IsPWMOutput(void)
+{
+	return PWMRunning;
+}
+
+/* Duty cycle of the PWM square wave in percent, 1 to 99. A running
+ * output changes at the end of its period. The DAC square is always 50. */
+uint8_t SetDutyCycle(uint32_t duty_percent)
+{
+	if(duty_percent<1||duty_percent>99)
+		return 0;
+
+	PWMDuty = duty_percent;
+	if(PWMRunning)
+		PWM_Generate(PWMFrequency);
+	return 1;
+}
+
+uint32_t GetDutyCycle(void)
+{
+	return PWMDuty;
+}
@@ -0,0 +1,119 @@
+#include "WaveGenPriv.h"
+
+
+/* Run length playback of mostly flat shapes. Every run is a level and the
+ * number of timer ticks it is held for. TIM6 triggers both DAC channels:
+ * channel 1 requests DMA_CHN for the next level as usual, and the DMA
+ * request of channel 2 moves the next duration into TIM6->ARR on
+ * RUNLENGTH_DMA_CHN. The reload is preloaded, so at every update the
+ * level and its duration take over together. A 1 percent pulse is two
+ * runs instead of a hundred samples, and every edge sits on a single
+ * timer tick.
+ *
+ * Both DMA transfers have to finish before the next update, and the DAC
+ * needs time to settle, so a run lasts at least DAC_FAST_SAMPLE_WAIT_TIME_NS.
+ * Channel 2 only serves as a DMA request and holds 0 on PA5. The runs
+ * repeat from the start. */
+
+//both lists are in the engine memory
+#define RunLevel				(EngineMemory.runLength.level)
+#define RunReload				(EngineMemory.runLength.reload)
+static uint8_t RunLengthRunning;
+
+/* Plays count runs in a loop. Levels are 12 bit codes at full scale and
+ * scale with the amplitude, durations are ticks of SystemCoreClock divided
+ * by prescale+1. Stops whatever was playing. Returns the frequency of the
+ * whole pattern in millihertz, 0 if a run is out of range. */
+uint32_t StartRunLength(const struct WAVEGEN_RUN* pRuns, uint32_t count, uint32_t prescale, float amplitude)
+{
+	struct DAC_config dacConf;
+	struct DMA_config dmaConf;
+	struct TIMER_config timConf;
+	uint32_t amplitude_in_resolution;
+	uint32_t min_ticks;
+	uint64_t total;
+	uint32_t i;
+
+	StopOutput();
+
+	if(amplitude>MAX_AMPLITUDE_FLOAT||amplitude<MIN_AMPLITUDE_FLOAT||
+		count<2||count>RUNLENGTH_MAX_RUNS||prescale>0xFFFF)
+		return 0;
+
+	min_ticks = (uint32_t)(((uint64_t)SystemCoreClock*DAC_FAST_SAMPLE_WAIT_TIME_NS/1000000000+prescale)/(prescale+1));
+	amplitude_in_resolution = AmplitudeToResolution(amplitude);
+
+	total = 0;
+	for(i=0;i<count;i++)
+	{
+		if(pRuns[i].level>DAC_RESOLUTION-1||pRuns[i].ticks<min_ticks||pRuns[i].ticks==0)
+			return 0;
+
+		RunLevel[i] = TO_SAMPLE((pRuns[i].level*amplitude_in_resolution+(DAC_RESOLUTION-1)/2)/(DAC_RESOLUTION-1));
+		RunReload[i] = pRuns[i].ticks-1;
+		total += pRuns[i].ticks;
+	}
+
+	TIMER_disable(TIM6);
+	DMA_disable(DMA_CHN);
+	DMA_disable(RUNLENGTH_DMA_CHN);
+	DAC_disable(DAC_CHN);
+	DAC_disable(DAC_CHN2);
+
+	//the last run is on before the first update, the DMA starts at run 0
+	timConf.count = RunReload[count-1];
+	timConf.prescale = prescale;
+	timConf.mode = TIMER_MODE_CONTINUOUS;
+	timConf.mmode = TIMER_MASTERMODE_UPDATE;
+	timConf.UGInt = TIMER_UGINTERRUPT_DISABLE;
+	timConf.intEnable = false;
+
+	TIMER_init(TIM6, timConf, NULL);
+	TIMER_generateEvent(TIM6);
+
+	dacConf.dma = DAC_DMA_ENABLE;
+	dacConf.trig = DAC_TRIGGER_TIMER6;
+
+	DAC_init(DAC_CHN, dacConf);
+	SAMPLE_DAC_REGISTER = RunLevel[count-1];
+	DAC_enable(DAC_CHN);
+	DAC_init(DAC_CHN2, dacConf);
+	DAC_writeSingle(DAC_CHN2, 0, DAC_RESOLUTION_12);
+	DAC_enable(DAC_CHN2);
+
+	dmaConf.numWrite = count;
+	dmaConf.readMem = RunLevel;
+	dmaConf.writeMem = (uint32_t *)(&SAMPLE_DAC_REGISTER);
+	dmaConf.memSize = SAMPLE_DMA_SIZE;
+	dmaConf.periphSize = DMA_SIZE_32;
+	dmaConf.circular = true;
+	dmaConf.intEnable = false;
+
+	DMA_init(DMA_CHN, dmaConf, NULL);
+	DMA_enable(DMA_CHN);
+
+	dmaConf.readMem = RunReload;
+	dmaConf.writeMem = (uint32_t *)(&TIM6->ARR);
+	dmaConf.memSize = DMA_SIZE_16;
+
+	DMA_init(RUNLENGTH_DMA_CHN, dmaConf, NULL);
+	DMA_enable(RUNLENGTH_DMA_CHN);
+
+	TIMER_enable(TIM6);
+
+	RunLengthRunning = 1;
+	total *= prescale+1;
+	return (uint32_t)(((uint64_t)SystemCoreClock*1000+total/2)/total);
+}
+
+void StopRunLength(void)
+{
+	if(!RunLengthRunning)
+		return;
+
+	TIMER_disable(TIM6);
+	DMA_disable(RUNLENGTH_DMA_CHN);
+	DAC_configDMA(DAC_CHN2, DAC_DMA_DISABLE);
+	DAC_disable(DAC_CHN2);
+	RunLengthRunning = 0;
+}
@@ -0,0 +1,225 @@
+#include "WaveGenPriv.h"
+
+
+/* Sequencer for test profiles. Every segment is a waveform, frequency and
+ * amplitude held for a number of whole cycles. The table engine plays the
+ * segment as usual and the transfer complete interrupt counts its cycles.
+ * On the last one it points the DMA at the table of the next segment and
+ * writes its reload and prescaler, which take over at the next update, so
+ * the segments follow each other without a gap. That update still clocks
+ * out the last sample of the old table, already in DHR, so it is held for
+ * one period of the new segment's timing.
+ *
+ * Tables are made in PendSV at the lowest priority, one segment ahead,
+ * while the current one plays. A table not ready in time makes the
+ * current segment play one more cycle, see GetSequenceLate. Nothing needs
+ * the main loop, a sequence keeps going while a menu waits for input.
+ * Channel 1 at the normal DAC rate only. */
+
+enum SEQUENCE_STATES
+{
+	SEQUENCE_IDLE=0,
+	SEQUENCE_RUNNING,
+	SEQUENCE_DONE			//last segment over, output held
+};
+
+//the steps are in the engine memory
+#define SequenceStep			(EngineMemory.sequence)
+static uint32_t SequenceLength;
+static uint8_t SequenceLoop;
+static volatile enum SEQUENCE_STATES SequenceState;
+
+static volatile uint32_t SequenceIndex;
+static volatile uint32_t CyclesLeft;
+static volatile uint32_t SequenceLate;
+
+//handed between the DMA interrupt and PendSV, each holds a cache lock
+static const sample_t* PlayingTable;
+static const sample_t* volatile NextTable;
+static volatile uint8_t NextReady;
+static const sample_t* volatile ReleaseTable;
+
+//SequenceLength once a sequence that does not loop is over
+static uint32_t Sequence_Next(uint32_t index)
+{
+	index++;
+	if(index<SequenceLength)
+		return index;
+	return SequenceLoop?0:SequenceLength;
+}
+
+/* Releases the table the DMA left and makes the next one. The DMA
+ * interrupt only moves on once NextReady is set, so neither table changes
+ * under this. */
+void PendSV_Handler(void)
+{
+	const sample_t* pTable;
+	uint32_t next;
+
+	if(SequenceState==SEQUENCE_IDLE||!Cache_TryEnter())
+		return;
+
+	if(ReleaseTable)
+	{
+		Cache_Unlock(ReleaseTable);
+		ReleaseTable = NULL;
+	}
+
+	next = Sequence_Next(SequenceIndex);
+	if(SequenceState==SEQUENCE_RUNNING&&!NextReady&&next<SequenceLength)
+	{
+		pTable = Cache_GetTable(SequenceStep[next].type,SequenceStep[next].noOfSample,SequenceStep[next].amplitude);
+		if(pTable)
+		{
+			Cache_Lock(pTable);
+			NextTable = pTable;
+			NextReady = 1;
+		}
+	}
+
+	Cache_Leave();
+}
+
+/* DMA callback, the DMA has just sent the last sample of a cycle */
+static void Sequence_Cycle(DMA_event_t event)
+{
+	uint32_t next;
+
+	if(event!=DMA_EVENT_TRANSFER_COMPLETE)
+		return;
+
+	if(--CyclesLeft)
+		return;
+
+	next = Sequence_Next(SequenceIndex);
+	if(next==SequenceLength)
+	{
+		//one more update sends the last sample, then TIM6 stops
+		TIMER_setMode(TIM6, TIMER_MODE_ONEPULSE);
+		DMA_disableInterrupt(DMA_CHN, DMA_EVENT_TRANSFER_COMPLETE);
+		SequenceState = SEQUENCE_DONE;
+		return;
+	}
+
+	if(!NextReady)
+	{
+		//the cache may have had no room, PendSV tries again
+		CyclesLeft = 1;
+		SequenceLate++;
+		SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+		return;
+	}
+
+	DMA_setSource(DMA_CHN, NextTable, SequenceStep[next].noOfSample);
+	TIMER_setCount(TIM6, SequenceStep[next].timerCount);
+	TIMER_setPrescaler(TIM6, SequenceStep[next].timerPrescale);
+
+	ReleaseTable = PlayingTable;
+	PlayingTable = NextTable;
+	NextReady = 0;
+	SequenceIndex = next;
+	CyclesLeft = SequenceStep[next].cycles;
+	SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+}
+
+/* Plays count segments in order, over and over if loop is set, otherwise
+ * the output holds the last sample. Stops whatever was playing. Returns 0
+ * if a segment is out of range. */
+uint8_t StartSequence(const struct WAVEGEN_SEGMENT* pSegments, uint32_t count, uint8_t loop)
+{
+	struct WAVEFORM_TIMING timing;
+	const sample_t* pTable;
+	uint64_t cycles;
+	uint32_t i;
+
+	StopOutput();
+
+	if(count==0||count>SEQUENCE_MAX_SEGMENTS)
+		return 0;
+
+	for(i=0;i<count;i++)
+	{
+		//the switch interrupt needs the time of a sample at the normal rate
+		if(pSegments[i].frequency==0||pSegments[i].frequency>MAX_FREQUENCY||
+			(pSegments[i].cycles==0&&pSegments[i].duration_ms==0)||
+			!ProcessWaveformParam(pSegments[i].waveform_types,pSegments[i].frequency*1000,pSegments[i].amplitude,&timing))
+			return 0;
+
+		cycles = pSegments[i].cycles;
+		if(cycles==0)
+		{
+			cycles = ((uint64_t)pSegments[i].duration_ms*timing.frequency_mhz+500000)/1000000;
+			if(cycles==0)
+				cycles = 1;
+			if(cycles>0xFFFFFFFF)
+				return 0;
+		}
+
+		SequenceStep[i].type = pSegments[i].waveform_types;
+		SequenceStep[i].amplitude = AmplitudeToResolution(pSegments[i].amplitude);
+		SequenceStep[i].noOfSample = timing.noOfSample;
+		SequenceStep[i].timerCount = timing.timerCount;
+		SequenceStep[i].timerPrescale = timing.timerPrescale;
+		SequenceStep[i].cycles = (uint32_t)cycles;
+	}
+
+	pTable = Cache_GetTable(SequenceStep[0].type,SequenceStep[0].noOfSample,SequenceStep[0].amplitude);
+	if(pTable==NULL)
+		return 0;
+	Cache_Lock(pTable);
+
+	SequenceLength = count;
+	SequenceLoop = loop;
+	SequenceIndex = 0;
+	CyclesLeft = SequenceStep[0].cycles;
+	SequenceLate = 0;
+	PlayingTable = pTable;
+	NextReady = 0;
+	ReleaseTable = NULL;
+	SequenceState = SEQUENCE_RUNNING;
+
+	//PendSV runs right away from here and has the second table ready
+	NVIC_SetPriority(PendSV_IRQn, 3);
+	SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+
+	ConfigureDAC(pTable,SequenceStep[0].noOfSample,SequenceStep[0].timerCount,SequenceStep[0].timerPrescale,OUTPUT_SAMPLE,&Sequence_Cycle);
+	DMA_enableInterrupt(DMA_CHN, DMA_EVENT_TRANSFER_COMPLETE);
+
+	return 1;
+}
+
+void StopSequence(void)
+{
+	if(SequenceState==SEQUENCE_IDLE)
+		return;
+
+	TIMER_disable(TIM6);
+	DMA_disableInterrupt(DMA_CHN, DMA_EVENT_TRANSFER_COMPLETE);
+	SequenceState = SEQUENCE_IDLE;
+	SCB->ICSR = SCB_ICSR_PENDSVCLR_Msk;
+
+	Cache_Unlock(PlayingTable);
+	PlayingTable = NULL;
+	if(NextReady)
+		Cache_Unlock(NextTable);
+	NextReady = 0;
+	Cache_Unlock(ReleaseTable);
+	ReleaseTable = NULL;
+}
+
+uint8_t IsSequenceRunning(void)
+{
+	return SequenceState==SEQUENCE_RUNNING;
+}
+
+/* Segment playing, or held at the end, counted from 0 */
+uint32_t GetSequenceSegment(void)
+{
+	return SequenceIndex;
+}
+
+/* Cycles added because a table was not ready in time */
+uint32_t GetSequenceLate(void)
+{
+	return SequenceLate;
+}
@@ -0,0 +1,203 @@
+#include "WaveGenPriv.h"
+
+
+/* Table shapes, integer arithmetic only. Nothing here touches the
+ * hardware, tools/bench_sine.c and tools/bench_ramp.c build it on a host. */
+
+/* Quarter-wave sine, SINE_QUARTER_STEPS+1 points over 0..pi/2 in Q15 */
+static const int16_t SineQuarterQ15[SINE_QUARTER_STEPS+1] =
+{
+	0, 201, 402, 603, 804, 1005, 1206, 1407,
+	1608, 1809, 2009, 2210, 2410, 2611, 2811, 3012,
+	3212, 3412, 3612, 3811, 4011, 4210, 4410, 4609,
+	4808, 5007, 5205, 5404, 5602, 5800, 5998, 6195,
+	6393, 6590, 6786, 6983, 7179, 7375, 7571, 7767,
+	7962, 8157, 8351, 8545, 8739, 8933, 9126, 9319,
+	9512, 9704, 9896, 10087, 10278, 10469, 10659, 10849,
+	11039, 11228, 11417, 11605, 11793, 11980, 12167, 12353,
+	12539, 12725, 12910, 13094, 13279, 13462, 13645, 13828,
+	14010, 14191, 14372, 14553, 14732, 14912, 15090, 15269,
+	15446, 15623, 15800, 15976, 16151, 16325, 16499, 16673,
+	16846, 17018, 17189, 17360, 17530, 17700, 17869, 18037,
+	18204, 18371, 18537, 18703, 18868, 19032, 19195, 19357,
+	19519, 19680, 19841, 20000, 20159, 20317, 20475, 20631,
+	20787, 20942, 21096, 21250, 21403, 21554, 21705, 21856,
+	22005, 22154, 22301, 22448, 22594, 22739, 22884, 23027,
+	23170, 23311, 23452, 23592, 23731, 23870, 24007, 24143,
+	24279, 24413, 24547, 24680, 24811, 24942, 25072, 25201,
+	25329, 25456, 25582, 25708, 25832, 25955, 26077, 26198,
+	26319, 26438, 26556, 26674, 26790, 26905, 27019, 27133,
+	27245, 27356, 27466, 27575, 27683, 27790, 27896, 28001,
+	28105, 28208, 28310, 28411, 28510, 28609, 28706, 28803,
+	28898, 28992, 29085, 29177, 29268, 29358, 29447, 29534,
+	29621, 29706, 29791, 29874, 29956, 30037, 30117, 30195,
+	30273, 30349, 30424, 30498, 30571, 30643, 30714, 30783,
+	30852, 30919, 30985, 31050, 31113, 31176, 31237, 31297,
+	31356, 31414, 31470, 31526, 31580, 31633, 31685, 31736,
+	31785, 31833, 31880, 31926, 31971, 32014, 32057, 32098,
+	32137, 32176, 32213, 32250, 32285, 32318, 32351, 32382,
+	32412, 32441, 32469, 32495, 32521, 32545, 32567, 32589,
+	32609, 32628, 32646, 32663, 32678, 32692, 32705, 32717,
+	32728, 32737, 32745, 32752, 32757, 32761, 32765, 32766,
+	32767
+};
+
+/* Bresenham-style ramp: pTable[i] = Amplitude_In_Resolution*i/NoOfSample
+ * with a single divide per table instead of one per sample. */
+static void GenerateSawToothTable(sample_t* pTable, uint32_t NoOfSample, uint32_t Amplitude_In_Resolution)
+{
+	uint32_t i;
+	uint32_t value;
+	uint32_t remainder;
+	uint32_t value_step;
+	uint32_t remainder_step;
+
+	value_step = Amplitude_In_Resolution/NoOfSample;
+	remainder_step = Amplitude_In_Resolution-value_step*NoOfSample;
+
+	value = 0;
+	remainder = 0;
+	for(i=0;i<NoOfSample;i++)
+	{
+		pTable[i]=TO_SAMPLE(value);
+
+		value += value_step;
+		remainder += remainder_step;
+		if(remainder>=NoOfSample)
+		{
+			remainder -= NoOfSample;
+			value++;
+		}
+	}
+}
+
+/* pTable[i] = 2*Amplitude_In_Resolution*min(i,NoOfSample-i)/NoOfSample.
+ * The rising half is accumulated like the sawtooth and the falling half
+ * mirrors it, so odd sample counts fill every entry symmetrically. */
+static void GenerateTriangularTable(sample_t* pTable, uint32_t NoOfSample, uint32_t Amplitude_In_Resolution)
+{
+	uint32_t i;
+	uint32_t value;
+	uint32_t remainder;
+	uint32_t value_step;
+	uint32_t remainder_step;
+
+	value_step = 2*Amplitude_In_Resolution/NoOfSample;
+	remainder_step = 2*Amplitude_In_Resolution-value_step*NoOfSample;
+
+	value = 0;
+	remainder = 0;
+	for(i=0;i<=NoOfSample/2;i++)
+	{
+		pTable[i]=TO_SAMPLE(value);
+
+		value += value_step;
+		remainder += remainder_step;
+		if(remainder>=NoOfSample)
+		{
+			remainder -= NoOfSample;
+			value++;
+		}
+	}
+
+	for(;i<NoOfSample;i++)
+	{
+		pTable[i]=pTable[NoOfSample-i];
+	}
+}
+
+/* Returns sin(2*pi*phase/2^32) in Q15 using the quarter-wave table.
+ * Linear interpolation keeps the error within 0.7 Q15 LSB. */
+int32_t SineQ15(uint32_t phase)
+{
+	uint32_t quadrant;
+	uint32_t pos;
+	uint32_t idx;
+	uint32_t frac;
+	int32_t value;
+
+	quadrant = phase>>30;
+	pos = (phase>>(30-SINE_QUARTER_BITS-16))&((SINE_QUARTER_STEPS<<16)-1);
+
+	//odd quadrants run the table backwards
+	if(quadrant&1)
+		pos = (SINE_QUARTER_STEPS<<16)-pos;
+
+	idx = pos>>16;
+	frac = pos&0xFFFF;
+
+	value = SineQuarterQ15[idx];
+	if(frac)
+		value += ((SineQuarterQ15[idx+1]-value)*(int32_t)frac)>>16;
+
+	return (quadrant&2)?-value:value;
+}
+
+/* Integer-only replacement for (sin(x)+1)*(Amplitude_In_Resolution+1)/2.
+ * The result never differs from the double-precision version by more
+ * than 1 LSB and never exceeds Amplitude_In_Resolution. */
+static void GenerateSineTable(sample_t* pTable, uint32_t NoOfSample, uint32_t Amplitude_In_Resolution)
+{
+	uint32_t i;
+	uint32_t phase;
+	uint32_t phase_step;
+	
+	phase = 0;
+	phase_step = (uint32_t)((((uint64_t)1<<32)+NoOfSample/2)/NoOfSample);
+
+	for(i=0;i<NoOfSample;i++)
+	{
+		pTable[i]=TO_SAMPLE(((uint32_t)(SineQ15(phase)+32768)*(Amplitude_In_Resolution+1))>>16);
+		phase += phase_step;
+	}
+}
+
+static void GenerateSquareTable(sample_t* pTable, uint32_t Amplitude_In_Resolution)
+{
+	pTable[0]=0;
+	pTable[1]=TO_SAMPLE(Amplitude_In_Resolution);
+}
+
+/* Rescales a table to a new amplitude with a Q16 multiply and shift per
+ * sample. Rounding adds at most 0.5 LSB to the source error scaled by
+ * New_Amplitude/Old_Amplitude. */
+void ScaleWaveFormTable(sample_t* pTable, const sample_t* pSource, uint32_t NoOfSample, uint32_t Old_Amplitude, uint32_t New_Amplitude)
+{
+	uint32_t i;
+	uint32_t scale;
+	uint32_t code;
+
+	scale = ((New_Amplitude<<16)+Old_Amplitude/2)/Old_Amplitude;
+
+	//source codes never exceed Old_Amplitude, so code*scale fits 32 bits
+	for(i=0;i<NoOfSample;i++)
+	{
+		code = ((uint32_t)pSource[i]<<SAMPLE_SHIFT)*scale;
+		code = (code+0x8000)>>16;
+		if(code>New_Amplitude)
+			code = New_Amplitude;
+		pTable[i]=TO_SAMPLE(code);
+	}
+}
+
+void GenerateWaveFormTable(sample_t* pTable, enum WAVEFORM_TYPES waveform_types, uint32_t NoOfSample, uint32_t Amplitude_In_Resolution)
+{
+	switch (waveform_types)
+	{
+		case WAVEFORM_TYPE_SINE:
+			GenerateSineTable(pTable,NoOfSample,Amplitude_In_Resolution);
+		break;
+		case WAVEFORM_TYPE_SAWTOOTH:
+			GenerateSawToothTable(pTable,NoOfSample,Amplitude_In_Resolution);
+		break;
+		case WAVEFORM_TYPE_TRIANGULAR:
+			GenerateTriangularTable(pTable,NoOfSample,Amplitude_In_Resolution);
+		break;
+		case WAVEFORM_TYPE_SQUARE:
+			GenerateSquareTable(pTable,Amplitude_In_Resolution);
+		break;
+		case WAVEFORM_TYPE_ARBITRARY:
+			GenerateArbitraryTable(pTable,NoOfSample,Amplitude_In_Resolution);
+		break;
+	}
+}
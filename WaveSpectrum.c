@@ -0,0 +1,238 @@
+#include "WaveGenPriv.h"
+
+
+/* Shapes built from a list of harmonics with a fixed-point inverse FFT.
+ * Every harmonic n puts amplitude/2 into bins n and SPECTRUM_SIZE-n, the
+ * second one conjugated, so the transform is real and holds
+ *
+ *	sum of amplitude*sin(2*pi*n*t + phase)
+ *
+ * over one cycle of the fundamental. The transform runs in place, radix-2
+ * decimation in time on 16 bit values with SineQ15 for the twiddles, the
+ * real half in the spare upload buffer and the imaginary half borrowed
+ * from the table cache for the time of the transform. Before
+ * a stage the whole block is halved until no value can overflow, which
+ * keeps the precision the spectrum allows without clipping. The result is
+ * stretched to the full 12 bit range and replaces the uploaded shape, it
+ * plays as WAVEFORM_TYPE_ARBITRARY and the amplitude setting applies.
+ *
+ * Tone pairs that are not harmonics of each other need a common
+ * fundamental: 697 Hz and 1209 Hz are harmonics 70 and 121 of 10 Hz within
+ * 0.5 percent, played at 10 Hz. */
+
+//the largest bin after scaling, leaves room for the first butterflies
+#define SPECTRUM_FULL_SCALE		16383
+//|a+w*b| per component stays within 32767 for parts below 32767/(1+sqrt(2))
+#define SPECTRUM_HEADROOM		13573
+
+#if SPECTRUM_SIZE>UPLOAD_MAX_SAMPLE
+#error "SPECTRUM_SIZE must fit the upload shape buffer"
+#endif
+
+static void Spectrum_BitReverse(int16_t* pReal, int16_t* pImag)
+{
+	uint32_t i;
+	uint32_t j;
+	uint32_t bit;
+	int16_t temp;
+
+	j = 0;
+	for(i=1;i<SPECTRUM_SIZE;i++)
+	{
+		bit = SPECTRUM_SIZE>>1;
+		while(j&bit)
+		{
+			j ^= bit;
+			bit >>= 1;
+		}
+		j |= bit;
+
+		if(i<j)
+		{
+			temp = pReal[i];
+			pReal[i] = pReal[j];
+			pReal[j] = temp;
+			temp = pImag[i];
+			pImag[i] = pImag[j];
+			pImag[j] = temp;
+		}
+	}
+}
+
+//halves the block as often as the next stage needs to stay in range,
+//a stage can grow a value by 1+sqrt(2). Returns the number of halvings.
+static uint32_t Spectrum_Headroom(int16_t* pReal, int16_t* pImag)
+{
+	int32_t max;
+	uint32_t shift;
+	uint32_t i;
+
+	max = 0;
+	for(i=0;i<SPECTRUM_SIZE;i++)
+	{
+		if(pReal[i]>max)
+			max = pReal[i];
+		if(-pReal[i]>max)
+			max = -pReal[i];
+		if(pImag[i]>max)
+			max = pImag[i];
+		if(-pImag[i]>max)
+			max = -pImag[i];
+	}
+
+	shift = 0;
+	while(max>SPECTRUM_HEADROOM)
+	{
+		max >>= 1;
+		shift++;
+	}
+	if(shift==0)
+		return 0;
+
+	for(i=0;i<SPECTRUM_SIZE;i++)
+	{
+		pReal[i] >>= shift;
+		pImag[i] >>= shift;
+	}
+
+	return shift;
+}
+
+/* Returns the block exponent, the result is the inverse transform
+ * divided by 2 to its power */
+static uint32_t Spectrum_Inverse(int16_t* pReal, int16_t* pImag)
+{
+	uint32_t scale;
+	uint32_t size;
+	uint32_t half;
+	uint32_t shift;
+	uint32_t phase;
+	uint32_t i;
+	uint32_t j;
+	int32_t wr;
+	int32_t wi;
+	int32_t tr;
+	int32_t ti;
+
+	Spectrum_BitReverse(pReal,pImag);
+
+	scale = 0;
+	shift = 31;
+	for(size=2;size<=SPECTRUM_SIZE;size<<=1)
+	{
+		scale += Spectrum_Headroom(pReal,pImag);
+
+		half = size>>1;
+		for(j=0;j<half;j++)
+		{
+			//e^(+2*pi*j/size), the inverse direction
+			phase = j<<shift;
+			wr = SineQ15(phase+0x40000000);
+			wi = SineQ15(phase);
+
+			for(i=j;i<SPECTRUM_SIZE;i+=size)
+			{
+				tr = (wr*pReal[i+half]-wi*pImag[i+half])>>15;
+				ti = (wr*pImag[i+half]+wi*pReal[i+half])>>15;
+
+				pReal[i+half] = (int16_t)(pReal[i]-tr);
+				pImag[i+half] = (int16_t)(pImag[i]-ti);
+				pReal[i] = (int16_t)(pReal[i]+tr);
+				pImag[i] = (int16_t)(pImag[i]+ti);
+			}
+		}
+		shift--;
+	}
+
+	return scale;
+}
+
+/* Replaces the arbitrary shape with the sum of count harmonics of one
+ * cycle. Numbers run from 1 to SPECTRUM_SIZE/2-1 and may appear once,
+ * amplitudes are relative to each other and phases are in degrees from
+ * sine. Returns 0 and leaves the shape alone if the list is invalid, all
+ * amplitudes are 0 or the cache has no room for the imaginary half. */
+uint8_t SetHarmonics(const struct WAVEGEN_HARMONIC* pHarmonics, uint32_t count)
+{
+	int16_t* pReal;
+	int16_t* pImag;
+	uint32_t max_amplitude;
+	uint32_t magnitude;
+	uint32_t phase;
+	uint32_t range;
+	uint32_t n;
+	uint32_t i;
+	uint32_t j;
+	int32_t min;
+	int32_t max;
+
+	if(count==0||count>SPECTRUM_MAX_HARMONICS)
+		return 0;
+
+	max_amplitude = 0;
+	for(i=0;i<count;i++)
+	{
+		if(pHarmonics[i].number==0||pHarmonics[i].number>=SPECTRUM_SIZE/2||pHarmonics[i].phase_degree>=360)
+			return 0;
+		for(j=0;j<i;j++)
+		{
+			if(pHarmonics[j].number==pHarmonics[i].number)
+				return 0;
+		}
+		if(pHarmonics[i].amplitude>max_amplitude)
+			max_amplitude = pHarmonics[i].amplitude;
+	}
+	if(max_amplitude==0)
+		return 0;
+
+	pImag = Cache_Borrow(SPECTRUM_SIZE*sizeof(int16_t));
+	if(pImag==NULL)
+		return 0;
+
+	//the spare shape buffer holds the real half until it is committed
+	pReal = (int16_t*)Upload_SpareShape();
+	for(i=0;i<SPECTRUM_SIZE;i++)
+	{
+		pReal[i] = 0;
+		pImag[i] = 0;
+	}
+
+	//sin(x+phase) is cos(x+phase-90), so the bin is magnitude*(sin(phase)-j*cos(phase))
+	for(i=0;i<count;i++)
+	{
+		n = pHarmonics[i].number;
+		magnitude = (pHarmonics[i].amplitude*SPECTRUM_FULL_SCALE+max_amplitude/2)/max_amplitude;
+		phase = (uint32_t)(((uint64_t)pHarmonics[i].phase_degree<<32)/360);
+
+		pReal[n] = (int16_t)(((int32_t)magnitude*SineQ15(phase))>>15);
+		pImag[n] = (int16_t)(-(((int32_t)magnitude*SineQ15(phase+0x40000000))>>15));
+		pReal[SPECTRUM_SIZE-n] = pReal[n];
+		pImag[SPECTRUM_SIZE-n] = -pImag[n];
+	}
+
+	//the stretch below removes the block exponent
+	(void)Spectrum_Inverse(pReal,pImag);
+	Cache_Unlock(pImag);
+
+	min = pReal[0];
+	max = pReal[0];
+	for(i=1;i<SPECTRUM_SIZE;i++)
+	{
+		if(pReal[i]<min)
+			min = pReal[i];
+		if(pReal[i]>max)
+			max = pReal[i];
+	}
+	if(max==min)
+		return 0;
+
+	//the buffer becomes 12 bit codes in place
+	range = (uint32_t)(max-min);
+	for(i=0;i<SPECTRUM_SIZE;i++)
+	{
+		((uint16_t*)pReal)[i] = (uint16_t)(((uint32_t)(pReal[i]-min)*(DAC_RESOLUTION-1)+range/2)/range);
+	}
+
+	Upload_Commit(SPECTRUM_SIZE);
+	return 1;
+}
@@ -0,0 +1,148 @@
+#include "WaveGenPriv.h"
+#include "Serial.h"
+
+
+/* Plays samples straight from the serial port. The host sends unsigned
+ * 16 bit little endian PCM, the bytes are copied into a circular ping-pong
+ * buffer as they are and the DMA writes each halfword to the left aligned
+ * DHR12L1, which drops the low 4 bits. Each half is refilled from the RX
+ * ring buffer in the half transfer and transfer complete interrupts.
+ *
+ * After every refill the fill level of the RX ring buffer goes back to the
+ * host as a single byte in percent, so it can pace itself around 50. The
+ * interrupt only records it and StreamWaveform sends it while it waits,
+ * a full TX ring must not hold up the refill. A
+ * half that runs short holds the last sample and counts as an underrun
+ * once more data follows, the end of the stream does not count. */
+
+#define STREAM_BYTES_PER_SAMPLE		2
+//start, 8 data and stop bits
+#define STREAM_BITS_PER_BYTE			10
+
+//the ping-pong buffer is in the engine memory
+#define StreamBuffer			(EngineMemory.stream)
+
+static volatile uint32_t StreamedSamples;
+static volatile uint32_t StreamUnderruns;
+static uint32_t PendingUnderruns;
+static uint16_t LastSample;
+static volatile uint8_t StreamLevel;
+static volatile uint8_t LevelPending;
+
+static void Stream_Fill(uint16_t* pOut)
+{
+	uint32_t got;
+	uint32_t i;
+
+	//whole samples only, an odd byte waits for the next half
+	got = SER_Available()/STREAM_BYTES_PER_SAMPLE;
+	if(got>STREAM_HALF_BUFFER)
+		got = STREAM_HALF_BUFFER;
+	SER_Read((unsigned char*)pOut,got*STREAM_BYTES_PER_SAMPLE);
+
+	if(got)
+	{
+		StreamUnderruns += PendingUnderruns;
+		PendingUnderruns = 0;
+		StreamedSamples += got;
+		LastSample = pOut[got-1];
+	}
+
+	if(got<STREAM_HALF_BUFFER)
+	{
+		for(i=got;i<STREAM_HALF_BUFFER;i++)
+			pOut[i]=LastSample;
+		PendingUnderruns++;
+	}
+
+	StreamLevel = SER_Available()*100/(SER_RBUF_SIZE-1);
+	LevelPending = 1;
+}
+
+static void Stream_Refill(DMA_event_t event)
+{
+	if(event==DMA_EVENT_HALF_TRANSFER)
+		Stream_Fill(&StreamBuffer[0]);
+	else if(event==DMA_EVENT_TRANSFER_COMPLETE)
+		Stream_Fill(&StreamBuffer[STREAM_HALF_BUFFER]);
+}
+
+/* Streams at sample_rate until the host stops sending for STREAM_IDLE_MS.
+ * Waits up to STREAM_START_TIMEOUT_MS for the first samples. Returns the
+ * number of samples played, 0 if the rate is above GetStreamMaxRate() or
+ * nothing arrived. Whatever was playing is stopped. */
+uint32_t StreamWaveform(uint32_t sample_rate, uint32_t (*millis)(void))
+{
+	uint32_t ticks;
+	uint32_t prescale;
+	uint32_t last;
+	uint32_t start;
+	uint32_t seen;
+
+	if(sample_rate==0||sample_rate>GetStreamMaxRate())
+		return 0;
+
+	StopOutput();
+
+	StreamedSamples = 0;
+	StreamUnderruns = 0;
+	PendingUnderruns = 0;
+	LevelPending = 0;
+	LastSample = 0x8000;
+
+	//prefill both halves before the timer starts
+	start = millis();
+	while(SER_Available()<2*STREAM_HALF_BUFFER*STREAM_BYTES_PER_SAMPLE)
+	{
+		if(millis()-start>STREAM_START_TIMEOUT_MS)
+			return 0;
+	}
+	Stream_Fill(&StreamBuffer[0]);
+	Stream_Fill(&StreamBuffer[STREAM_HALF_BUFFER]);
+
+	ticks = (SystemCoreClock+sample_rate/2)/sample_rate;
+	prescale = (ticks-1)>>16;
+
+	ConfigureDAC(StreamBuffer,2*STREAM_HALF_BUFFER,(ticks+(prescale+1)/2)/(prescale+1)-1,prescale,OUTPUT_LEFT16,&Stream_Refill);
+	DMA_enableInterrupt(DMA_CHN, DMA_EVENT_HALF_TRANSFER);
+	DMA_enableInterrupt(DMA_CHN, DMA_EVENT_TRANSFER_COMPLETE);
+
+	seen = StreamedSamples;
+	last = millis();
+	while(millis()-last<=STREAM_IDLE_MS)
+	{
+		if(LevelPending)
+		{
+			LevelPending = 0;
+			SER_PutChar(StreamLevel);
+		}
+		if(StreamedSamples!=seen)
+		{
+			seen = StreamedSamples;
+			last = millis();
+		}
+	}
+
+	TIMER_disable(TIM6);
+	DMA_disableInterrupt(DMA_CHN, DMA_EVENT_HALF_TRANSFER);
+	DMA_disableInterrupt(DMA_CHN, DMA_EVENT_TRANSFER_COMPLETE);
+
+	return StreamedSamples;
+}
+
+/* Sample rate the serial line can keep up with */
+uint32_t GetStreamMaxRate(void)
+{
+	return SER_BAUDRATE/(STREAM_BITS_PER_BYTE*STREAM_BYTES_PER_SAMPLE);
+}
+
+uint32_t GetStreamUnderruns(void)
+{
+	return StreamUnderruns;
+}
+
+/* RX ring buffer fill level in percent at the last refill */
+uint32_t GetStreamLevel(void)
+{
+	return StreamLevel;
+}
@@ -0,0 +1,154 @@
+#include <math.h>
+#include "WaveGenPriv.h"
+
+
+/* Hardware timed frequency sweep. The table engine plays one cycle per
+ * table as usual while TIM7 ticks once per dwell time and requests
+ * SWEEP_DMA_CHN, which copies the next precomputed reload value into
+ * TIM6->ARR. The reload is preloaded, so every step lands on a sample
+ * boundary of the running table and the output stays phase continuous.
+ * The CPU is not involved until the sweep is stopped.
+ *
+ * The table length suits the highest frequency and the prescaler the
+ * lowest, so wide sweeps step more coarsely at the top. The reload list
+ * is circular and the sweep repeats from the start frequency. Dual output
+ * is not swept, channel 1 only. */
+
+//reload values are written one step ahead, see StartSweep, into the
+//engine memory
+#define SweepReload				(EngineMemory.sweepReload)
+static const sample_t* SweepTable;
+static uint8_t SweepRunning;
+
+static uint32_t Sweep_Frequency(uint32_t start_mhz, uint32_t stop_mhz, uint32_t step, uint32_t steps, enum WAVEGEN_SWEEP_SPACINGS spacing)
+{
+	float ratio;
+
+	if(spacing==WAVEGEN_SWEEP_LOG)
+	{
+		ratio = powf((float)stop_mhz/(float)start_mhz,(float)step/(float)(steps-1));
+		return (uint32_t)(start_mhz*ratio+0.5f);
+	}
+
+	if(stop_mhz>=start_mhz)
+		return start_mhz+(uint32_t)(((uint64_t)(stop_mhz-start_mhz)*step+(steps-1)/2)/(steps-1));
+	return start_mhz-(uint32_t)(((uint64_t)(start_mhz-stop_mhz)*step+(steps-1)/2)/(steps-1));
+}
+
+static uint16_t Sweep_Reload(uint32_t frequency_mhz, uint32_t noofsample, uint32_t prescale)
+{
+	uint64_t ticks;
+
+	ticks = ((uint64_t)SystemCoreClock*1000+(uint64_t)frequency_mhz*noofsample*(prescale+1)/2)/
+		((uint64_t)frequency_mhz*noofsample*(prescale+1));
+
+	if(ticks<2)
+		ticks = 2;
+	if(ticks>0x10000)
+		ticks = 0x10000;
+	return (uint16_t)(ticks-1);
+}
+
+/* Sweeps from start_frequency to stop_frequency in steps, holding each
+ * for dwell_ms. Stops whatever was playing. Returns 0 if either end is out
+ * of range or the table cannot be made. */
+uint8_t StartSweep(enum WAVEFORM_TYPES waveform_types, uint32_t start_frequency, uint32_t stop_frequency, uint32_t steps,
+	uint32_t dwell_ms, enum WAVEGEN_SWEEP_SPACINGS spacing, float amplitude)
+{
+	struct DMA_config dmaConf;
+	struct TIMER_config timConf;
+	const sample_t* pTable;
+	uint32_t max_frequency;
+	uint32_t min_frequency;
+	uint32_t noofsample;
+	uint32_t prescale;
+	uint64_t ticks;
+	uint32_t i;
+
+	StopOutput();
+
+	max_frequency = (start_frequency>stop_frequency)?start_frequency:stop_frequency;
+	min_frequency = (start_frequency<stop_frequency)?start_frequency:stop_frequency;
+
+	if(!IsParameterAllowed(waveform_types,max_frequency,amplitude)||
+		!IsParameterAllowed(waveform_types,min_frequency,amplitude)||
+		steps<2||steps>SWEEP_MAX_STEPS||dwell_ms==0||dwell_ms>0x10000)
+		return 0;
+
+	//as many samples as the top frequency allows
+	switch(waveform_types)
+	{
+		case WAVEFORM_TYPE_SQUARE:
+			noofsample = 2;
+		break;
+		default:
+			noofsample = MaxSamplePerCycle(max_frequency*1000);
+			if(waveform_types==WAVEFORM_TYPE_ARBITRARY&&GetUploadLength()<=noofsample)
+				noofsample = GetUploadLength();
+		break;
+	}
+	if(noofsample<2)
+		return 0;
+
+	//the prescaler has to reach the bottom frequency
+	ticks = ((uint64_t)SystemCoreClock+(uint64_t)min_frequency*noofsample/2)/((uint64_t)min_frequency*noofsample);
+	prescale = (uint32_t)((ticks-1)>>16);
+	if(prescale>0xFFFF)
+		return 0;
+
+	pTable = Cache_GetTable(waveform_types,noofsample,AmplitudeToResolution(amplitude));
+	if(pTable==NULL)
+		return 0;
+	Cache_Lock(pTable);
+	SweepTable = pTable;
+
+	//TIM6 starts on the first step, each TIM7 update loads the next
+	for(i=0;i<steps;i++)
+	{
+		SweepReload[i]=Sweep_Reload(Sweep_Frequency(start_frequency*1000,stop_frequency*1000,(i+1)%steps,steps,spacing),
+			noofsample,prescale);
+	}
+
+	ConfigureDAC(pTable,noofsample,Sweep_Reload(start_frequency*1000,noofsample,prescale),prescale,OUTPUT_SAMPLE,NULL);
+
+	dmaConf.numWrite = steps;
+	dmaConf.readMem = SweepReload;
+	dmaConf.writeMem = (uint32_t *)(&TIM6->ARR);
+	dmaConf.memSize = DMA_SIZE_16;
+	dmaConf.periphSize = DMA_SIZE_32;
+	dmaConf.circular = true;
+	dmaConf.intEnable = false;
+
+	DMA_disable(SWEEP_DMA_CHN);
+	DMA_init(SWEEP_DMA_CHN, dmaConf, NULL);
+	DMA_enable(SWEEP_DMA_CHN);
+
+	//TIM7 ticks in milliseconds
+	timConf.count = dwell_ms-1;
+	timConf.prescale = SystemCoreClock/1000-1;
+	timConf.mode = TIMER_MODE_CONTINUOUS;
+	timConf.mmode = TIMER_MASTERMODE_RESET;
+	timConf.UGInt = TIMER_UGINTERRUPT_DISABLE;
+	timConf.intEnable = false;
+
+	TIMER_init(TIM7, timConf, NULL);
+	//load the prescaler now rather than after the first dwell
+	TIMER_generateEvent(TIM7);
+	TIMER_enable(TIM7);
+
+	SweepRunning = 1;
+	return 1;
+}
+
+void StopSweep(void)
+{
+	if(!SweepRunning)
+		return;
+
+	TIMER_disable(TIM7);
+	DMA_disable(SWEEP_DMA_CHN);
+	TIMER_disable(TIM6);
+	Cache_Unlock(SweepTable);
+	SweepTable = NULL;
+	SweepRunning = 0;
+}
@@ -0,0 +1,2144 @@
+/* Generated by tools/gen_wavetables.py, do not edit */
+
+#include "WaveGenPriv.h"
+
+#define S(code)		TO_SAMPLE(code)
+
+static const sample_t Sine64[64] =
+{
+	S(2048), S(2248), S(2447), S(2642), S(2831), S(3013), S(3185), S(3347),
+	S(3496), S(3631), S(3750), S(3854), S(3940), S(4007), S(4056), S(4086),
+	S(4095), S(4086), S(4056), S(4007), S(3940), S(3854), S(3750), S(3631),
+	S(3496), S(3347), S(3185), S(3013), S(2831), S(2642), S(2447), S(2248),
+	S(2048), S(1847), S(1648), S(1453), S(1264), S(1082), S(910), S(748),
+	S(599), S(464), S(345), S(241), S(155), S(88), S(39), S(9),
+	S(0), S(9), S(39), S(88), S(155), S(241), S(345), S(464),
+	S(599), S(748), S(910), S(1082), S(1264), S(1453), S(1648), S(1847)
+};
+
+static const sample_t Sine128[128] =
+{
+	S(2048), S(2148), S(2248), S(2348), S(2447), S(2545), S(2642), S(2737),
+	S(2831), S(2923), S(3013), S(3100), S(3185), S(3267), S(3347), S(3423),
+	S(3496), S(3565), S(3631), S(3692), S(3750), S(3804), S(3854), S(3899),
+	S(3940), S(3976), S(4007), S(4034), S(4056), S(4073), S(4086), S(4093),
+	S(4095), S(4093), S(4086), S(4073), S(4056), S(4034), S(4007), S(3976),
+	S(3940), S(3899), S(3854), S(3804), S(3750), S(3692), S(3631), S(3565),
+	S(3496), S(3423), S(3347), S(3267), S(3185), S(3100), S(3013), S(2923),
+	S(2831), S(2737), S(2642), S(2545), S(2447), S(2348), S(2248), S(2148),
+	S(2048), S(1947), S(1847), S(1747), S(1648), S(1550), S(1453), S(1358),
+	S(1264), S(1172), S(1082), S(995), S(910), S(828), S(748), S(672),
+	S(599), S(530), S(464), S(403), S(345), S(291), S(241), S(196),
+	S(155), S(119), S(88), S(61), S(39), S(22), S(9), S(2),
+	S(0), S(2), S(9), S(22), S(39), S(61), S(88), S(119),
+	S(155), S(196), S(241), S(291), S(345), S(403), S(464), S(530),
+	S(599), S(672), S(748), S(828), S(910), S(995), S(1082), S(1172),
+	S(1264), S(1358), S(1453), S(1550), S(1648), S(1747), S(1847), S(1947)
+};
+
+static const sample_t Sine256[256] =
+{
+	S(2048), S(2098), S(2148), S(2198), S(2248), S(2298), S(2348), S(2398),
+	S(2447), S(2496), S(2545), S(2594), S(2642), S(2690), S(2737), S(2785),
+	S(2831), S(2877), S(2923), S(2968), S(3013), S(3057), S(3100), S(3143),
+	S(3185), S(3227), S(3267), S(3307), S(3347), S(3385), S(3423), S(3460),
+	S(3496), S(3531), S(3565), S(3598), S(3631), S(3662), S(3692), S(3722),
+	S(3750), S(3778), S(3804), S(3829), S(3854), S(3877), S(3899), S(3920),
+	S(3940), S(3958), S(3976), S(3992), S(4007), S(4021), S(4034), S(4046),
+	S(4056), S(4065), S(4073), S(4080), S(4086), S(4090), S(4093), S(4095),
+	S(4095), S(4095), S(4093), S(4090), S(4086), S(4080), S(4073), S(4065),
+	S(4056), S(4046), S(4034), S(4021), S(4007), S(3992), S(3976), S(3958),
+	S(3940), S(3920), S(3899), S(3877), S(3854), S(3829), S(3804), S(3778),
+	S(3750), S(3722), S(3692), S(3662), S(3631), S(3598), S(3565), S(3531),
+	S(3496), S(3460), S(3423), S(3385), S(3347), S(3307), S(3267), S(3227),
+	S(3185), S(3143), S(3100), S(3057), S(3013), S(2968), S(2923), S(2877),
+	S(2831), S(2785), S(2737), S(2690), S(2642), S(2594), S(2545), S(2496),
+	S(2447), S(2398), S(2348), S(2298), S(2248), S(2198), S(2148), S(2098),
+	S(2048), S(1997), S(1947), S(1897), S(1847), S(1797), S(1747), S(1697),
+	S(1648), S(1599), S(1550), S(1501), S(1453), S(1405), S(1358), S(1310),
+	S(1264), S(1218), S(1172), S(1127), S(1082), S(1038), S(995), S(952),
+	S(910), S(868), S(828), S(788), S(748), S(710), S(672), S(635),
+	S(599), S(564), S(530), S(497), S(464), S(433), S(403), S(373),
+	S(345), S(317), S(291), S(266), S(241), S(218), S(196), S(175),
+	S(155), S(137), S(119), S(103), S(88), S(74), S(61), S(49),
+	S(39), S(30), S(22), S(15), S(9), S(5), S(2), S(0),
+	S(0), S(0), S(2), S(5), S(9), S(15), S(22), S(30),
+	S(39), S(49), S(61), S(74), S(88), S(103), S(119), S(137),
+	S(155), S(175), S(196), S(218), S(241), S(266), S(291), S(317),
+	S(345), S(373), S(403), S(433), S(464), S(497), S(530), S(564),
+	S(599), S(635), S(672), S(710), S(748), S(788), S(828), S(868),
+	S(910), S(952), S(995), S(1038), S(1082), S(1127), S(1172), S(1218),
+	S(1264), S(1310), S(1358), S(1405), S(1453), S(1501), S(1550), S(1599),
+	S(1648), S(1697), S(1747), S(1797), S(1847), S(1897), S(1947), S(1997)
+};
+
+static const sample_t Sine512[512] =
+{
+	S(2048), S(2073), S(2098), S(2123), S(2148), S(2173), S(2198), S(2223),
+	S(2248), S(2273), S(2298), S(2323), S(2348), S(2373), S(2398), S(2422),
+	S(2447), S(2472), S(2496), S(2521), S(2545), S(2569), S(2594), S(2618),
+	S(2642), S(2666), S(2690), S(2714), S(2737), S(2761), S(2785), S(2808),
+	S(2831), S(2854), S(2877), S(2900), S(2923), S(2946), S(2968), S(2991),
+	S(3013), S(3035), S(3057), S(3079), S(3100), S(3122), S(3143), S(3164),
+	S(3185), S(3206), S(3227), S(3247), S(3267), S(3288), S(3307), S(3327),
+	S(3347), S(3366), S(3385), S(3404), S(3423), S(3441), S(3460), S(3478),
+	S(3496), S(3513), S(3531), S(3548), S(3565), S(3582), S(3598), S(3615),
+	S(3631), S(3646), S(3662), S(3677), S(3692), S(3707), S(3722), S(3736),
+	S(3750), S(3764), S(3778), S(3791), S(3804), S(3817), S(3829), S(3842),
+	S(3854), S(3865), S(3877), S(3888), S(3899), S(3909), S(3920), S(3930),
+	S(3940), S(3949), S(3958), S(3967), S(3976), S(3984), S(3992), S(4000),
+	S(4007), S(4014), S(4021), S(4028), S(4034), S(4040), S(4046), S(4051),
+	S(4056), S(4061), S(4065), S(4069), S(4073), S(4077), S(4080), S(4083),
+	S(4086), S(4088), S(4090), S(4092), S(4093), S(4094), S(4095), S(4095),
+	S(4095), S(4095), S(4095), S(4094), S(4093), S(4092), S(4090), S(4088),
+	S(4086), S(4083), S(4080), S(4077), S(4073), S(4069), S(4065), S(4061),
+	S(4056), S(4051), S(4046), S(4040), S(4034), S(4028), S(4021), S(4014),
+	S(4007), S(4000), S(3992), S(3984), S(3976), S(3967), S(3958), S(3949),
+	S(3940), S(3930), S(3920), S(3909), S(3899), S(3888), S(3877), S(3865),
+	S(3854), S(3842), S(3829), S(3817), S(3804), S(3791), S(3778), S(3764),
+	S(3750), S(3736), S(3722), S(3707), S(3692), S(3677), S(3662), S(3646),
+	S(3631), S(3615), S(3598), S(3582), S(3565), S(3548), S(3531), S(3513),
+	S(3496), S(3478), S(3460), S(3441), S(3423), S(3404), S(3385), S(3366),
+	S(3347), S(3327), S(3307), S(3288), S(3267), S(3247), S(3227), S(3206),
+	S(3185), S(3164), S(3143), S(3122), S(3100), S(3079), S(3057), S(3035),
+	S(3013), S(2991), S(2968), S(2946), S(2923), S(2900), S(2877), S(2854),
+	S(2831), S(2808), S(2785), S(2761), S(2737), S(2714), S(2690), S(2666),
+	S(2642), S(2618), S(2594), S(2569), S(2545), S(2521), S(2496), S(2472),
+	S(2447), S(2422), S(2398), S(2373), S(2348), S(2323), S(2298), S(2273),
+	S(2248), S(2223), S(2198), S(2173), S(2148), S(2123), S(2098), S(2073),
+	S(2048), S(2022), S(1997), S(1972), S(1947), S(1922), S(1897), S(1872),
+	S(1847), S(1822), S(1797), S(1772), S(1747), S(1722), S(1697), S(1673),
+	S(1648), S(1623), S(1599), S(1574), S(1550), S(1526), S(1501), S(1477),
+	S(1453), S(1429), S(1405), S(1381), S(1358), S(1334), S(1310), S(1287),
+	S(1264), S(1241), S(1218), S(1195), S(1172), S(1149), S(1127), S(1104),
+	S(1082), S(1060), S(1038), S(1016), S(995), S(973), S(952), S(931),
+	S(910), S(889), S(868), S(848), S(828), S(807), S(788), S(768),
+	S(748), S(729), S(710), S(691), S(672), S(654), S(635), S(617),
+	S(599), S(582), S(564), S(547), S(530), S(513), S(497), S(481),
+	S(464), S(449), S(433), S(418), S(403), S(388), S(373), S(359),
+	S(345), S(331), S(317), S(304), S(291), S(278), S(266), S(253),
+	S(241), S(230), S(218), S(207), S(196), S(186), S(175), S(165),
+	S(155), S(146), S(137), S(128), S(119), S(111), S(103), S(95),
+	S(88), S(81), S(74), S(67), S(61), S(55), S(49), S(44),
+	S(39), S(34), S(30), S(26), S(22), S(18), S(15), S(12),
+	S(9), S(7), S(5), S(3), S(2), S(1), S(0), S(0),
+	S(0), S(0), S(0), S(1), S(2), S(3), S(5), S(7),
+	S(9), S(12), S(15), S(18), S(22), S(26), S(30), S(34),
+	S(39), S(44), S(49), S(55), S(61), S(67), S(74), S(81),
+	S(88), S(95), S(103), S(111), S(119), S(128), S(137), S(146),
+	S(155), S(165), S(175), S(186), S(196), S(207), S(218), S(230),
+	S(241), S(253), S(266), S(278), S(291), S(304), S(317), S(331),
+	S(345), S(359), S(373), S(388), S(403), S(418), S(433), S(449),
+	S(464), S(481), S(497), S(513), S(530), S(547), S(564), S(582),
+	S(599), S(617), S(635), S(654), S(672), S(691), S(710), S(729),
+	S(748), S(768), S(788), S(807), S(828), S(848), S(868), S(889),
+	S(910), S(931), S(952), S(973), S(995), S(1016), S(1038), S(1060),
+	S(1082), S(1104), S(1127), S(1149), S(1172), S(1195), S(1218), S(1241),
+	S(1264), S(1287), S(1310), S(1334), S(1358), S(1381), S(1405), S(1429),
+	S(1453), S(1477), S(1501), S(1526), S(1550), S(1574), S(1599), S(1623),
+	S(1648), S(1673), S(1697), S(1722), S(1747), S(1772), S(1797), S(1822),
+	S(1847), S(1872), S(1897), S(1922), S(1947), S(1972), S(1997), S(2022)
+};
+
+static const sample_t Sine1024[1024] =
+{
+	S(2048), S(2060), S(2073), S(2085), S(2098), S(2110), S(2123), S(2135),
+	S(2148), S(2161), S(2173), S(2186), S(2198), S(2211), S(2223), S(2236),
+	S(2248), S(2261), S(2273), S(2286), S(2298), S(2311), S(2323), S(2336),
+	S(2348), S(2360), S(2373), S(2385), S(2398), S(2410), S(2422), S(2435),
+	S(2447), S(2459), S(2472), S(2484), S(2496), S(2508), S(2521), S(2533),
+	S(2545), S(2557), S(2569), S(2582), S(2594), S(2606), S(2618), S(2630),
+	S(2642), S(2654), S(2666), S(2678), S(2690), S(2702), S(2714), S(2726),
+	S(2737), S(2749), S(2761), S(2773), S(2785), S(2796), S(2808), S(2820),
+	S(2831), S(2843), S(2854), S(2866), S(2877), S(2889), S(2900), S(2912),
+	S(2923), S(2934), S(2946), S(2957), S(2968), S(2980), S(2991), S(3002),
+	S(3013), S(3024), S(3035), S(3046), S(3057), S(3068), S(3079), S(3090),
+	S(3100), S(3111), S(3122), S(3133), S(3143), S(3154), S(3164), S(3175),
+	S(3185), S(3196), S(3206), S(3216), S(3227), S(3237), S(3247), S(3257),
+	S(3267), S(3278), S(3288), S(3298), S(3307), S(3317), S(3327), S(3337),
+	S(3347), S(3356), S(3366), S(3376), S(3385), S(3395), S(3404), S(3414),
+	S(3423), S(3432), S(3441), S(3451), S(3460), S(3469), S(3478), S(3487),
+	S(3496), S(3504), S(3513), S(3522), S(3531), S(3539), S(3548), S(3556),
+	S(3565), S(3573), S(3582), S(3590), S(3598), S(3606), S(3615), S(3623),
+	S(3631), S(3639), S(3646), S(3654), S(3662), S(3670), S(3677), S(3685),
+	S(3692), S(3700), S(3707), S(3715), S(3722), S(3729), S(3736), S(3743),
+	S(3750), S(3757), S(3764), S(3771), S(3778), S(3784), S(3791), S(3798),
+	S(3804), S(3811), S(3817), S(3823), S(3829), S(3836), S(3842), S(3848),
+	S(3854), S(3860), S(3865), S(3871), S(3877), S(3882), S(3888), S(3893),
+	S(3899), S(3904), S(3909), S(3915), S(3920), S(3925), S(3930), S(3935),
+	S(3940), S(3944), S(3949), S(3954), S(3958), S(3963), S(3967), S(3971),
+	S(3976), S(3980), S(3984), S(3988), S(3992), S(3996), S(4000), S(4004),
+	S(4007), S(4011), S(4014), S(4018), S(4021), S(4025), S(4028), S(4031),
+	S(4034), S(4037), S(4040), S(4043), S(4046), S(4048), S(4051), S(4054),
+	S(4056), S(4059), S(4061), S(4063), S(4065), S(4067), S(4069), S(4071),
+	S(4073), S(4075), S(4077), S(4078), S(4080), S(4082), S(4083), S(4084),
+	S(4086), S(4087), S(4088), S(4089), S(4090), S(4091), S(4092), S(4092),
+	S(4093), S(4094), S(4094), S(4095), S(4095), S(4095), S(4095), S(4095),
+	S(4095), S(4095), S(4095), S(4095), S(4095), S(4095), S(4094), S(4094),
+	S(4093), S(4092), S(4092), S(4091), S(4090), S(4089), S(4088), S(4087),
+	S(4086), S(4084), S(4083), S(4082), S(4080), S(4078), S(4077), S(4075),
+	S(4073), S(4071), S(4069), S(4067), S(4065), S(4063), S(4061), S(4059),
+	S(4056), S(4054), S(4051), S(4048), S(4046), S(4043), S(4040), S(4037),
+	S(4034), S(4031), S(4028), S(4025), S(4021), S(4018), S(4014), S(4011),
+	S(4007), S(4004), S(4000), S(3996), S(3992), S(3988), S(3984), S(3980),
+	S(3976), S(3971), S(3967), S(3963), S(3958), S(3954), S(3949), S(3944),
+	S(3940), S(3935), S(3930), S(3925), S(3920), S(3915), S(3909), S(3904),
+	S(3899), S(3893), S(3888), S(3882), S(3877), S(3871), S(3865), S(3860),
+	S(3854), S(3848), S(3842), S(3836), S(3829), S(3823), S(3817), S(3811),
+	S(3804), S(3798), S(3791), S(3784), S(3778), S(3771), S(3764), S(3757),
+	S(3750), S(3743), S(3736), S(3729), S(3722), S(3715), S(3707), S(3700),
+	S(3692), S(3685), S(3677), S(3670), S(3662), S(3654), S(3646), S(3639),
+	S(3631), S(3623), S(3615), S(3606), S(3598), S(3590), S(3582), S(3573),
+	S(3565), S(3556), S(3548), S(3539), S(3531), S(3522), S(3513), S(3504),
+	S(3496), S(3487), S(3478), S(3469), S(3460), S(3451), S(3441), S(3432),
+	S(3423), S(3414), S(3404), S(3395), S(3385), S(3376), S(3366), S(3356),
+	S(3347), S(3337), S(3327), S(3317), S(3307), S(3298), S(3288), S(3278),
+	S(3267), S(3257), S(3247), S(3237), S(3227), S(3216), S(3206), S(3196),
+	S(3185), S(3175), S(3164), S(3154), S(3143), S(3133), S(3122), S(3111),
+	S(3100), S(3090), S(3079), S(3068), S(3057), S(3046), S(3035), S(3024),
+	S(3013), S(3002), S(2991), S(2980), S(2968), S(2957), S(2946), S(2934),
+	S(2923), S(2912), S(2900), S(2889), S(2877), S(2866), S(2854), S(2843),
+	S(2831), S(2820), S(2808), S(2796), S(2785), S(2773), S(2761), S(2749),
+	S(2737), S(2726), S(2714), S(2702), S(2690), S(2678), S(2666), S(2654),
+	S(2642), S(2630), S(2618), S(2606), S(2594), S(2582), S(2569), S(2557),
+	S(2545), S(2533), S(2521), S(2508), S(2496), S(2484), S(2472), S(2459),
+	S(2447), S(2435), S(2422), S(2410), S(2398), S(2385), S(2373), S(2360),
+	S(2348), S(2336), S(2323), S(2311), S(2298), S(2286), S(2273), S(2261),
+	S(2248), S(2236), S(2223), S(2211), S(2198), S(2186), S(2173), S(2161),
+	S(2148), S(2135), S(2123), S(2110), S(2098), S(2085), S(2073), S(2060),
+	S(2048), S(2035), S(2022), S(2010), S(1997), S(1985), S(1972), S(1960),
+	S(1947), S(1934), S(1922), S(1909), S(1897), S(1884), S(1872), S(1859),
+	S(1847), S(1834), S(1822), S(1809), S(1797), S(1784), S(1772), S(1759),
+	S(1747), S(1735), S(1722), S(1710), S(1697), S(1685), S(1673), S(1660),
+	S(1648), S(1636), S(1623), S(1611), S(1599), S(1587), S(1574), S(1562),
+	S(1550), S(1538), S(1526), S(1513), S(1501), S(1489), S(1477), S(1465),
+	S(1453), S(1441), S(1429), S(1417), S(1405), S(1393), S(1381), S(1369),
+	S(1358), S(1346), S(1334), S(1322), S(1310), S(1299), S(1287), S(1275),
+	S(1264), S(1252), S(1241), S(1229), S(1218), S(1206), S(1195), S(1183),
+	S(1172), S(1161), S(1149), S(1138), S(1127), S(1116), S(1104), S(1093),
+	S(1082), S(1071), S(1060), S(1049), S(1038), S(1027), S(1016), S(1005),
+	S(995), S(984), S(973), S(963), S(952), S(941), S(931), S(920),
+	S(910), S(899), S(889), S(879), S(868), S(858), S(848), S(838),
+	S(828), S(818), S(807), S(798), S(788), S(778), S(768), S(758),
+	S(748), S(739), S(729), S(719), S(710), S(700), S(691), S(682),
+	S(672), S(663), S(654), S(645), S(635), S(626), S(617), S(608),
+	S(599), S(591), S(582), S(573), S(564), S(556), S(547), S(539),
+	S(530), S(522), S(513), S(505), S(497), S(489), S(481), S(472),
+	S(464), S(457), S(449), S(441), S(433), S(425), S(418), S(410),
+	S(403), S(395), S(388), S(380), S(373), S(366), S(359), S(352),
+	S(345), S(338), S(331), S(324), S(317), S(311), S(304), S(297),
+	S(291), S(285), S(278), S(272), S(266), S(259), S(253), S(247),
+	S(241), S(236), S(230), S(224), S(218), S(213), S(207), S(202),
+	S(196), S(191), S(186), S(180), S(175), S(170), S(165), S(160),
+	S(155), S(151), S(146), S(141), S(137), S(132), S(128), S(124),
+	S(119), S(115), S(111), S(107), S(103), S(99), S(95), S(91),
+	S(88), S(84), S(81), S(77), S(74), S(70), S(67), S(64),
+	S(61), S(58), S(55), S(52), S(49), S(47), S(44), S(41),
+	S(39), S(37), S(34), S(32), S(30), S(28), S(26), S(24),
+	S(22), S(20), S(18), S(17), S(15), S(13), S(12), S(11),
+	S(9), S(8), S(7), S(6), S(5), S(4), S(3), S(3),
+	S(2), S(1), S(1), S(1), S(0), S(0), S(0), S(0),
+	S(0), S(0), S(0), S(0), S(0), S(1), S(1), S(1),
+	S(2), S(3), S(3), S(4), S(5), S(6), S(7), S(8),
+	S(9), S(11), S(12), S(13), S(15), S(17), S(18), S(20),
+	S(22), S(24), S(26), S(28), S(30), S(32), S(34), S(37),
+	S(39), S(41), S(44), S(47), S(49), S(52), S(55), S(58),
+	S(61), S(64), S(67), S(70), S(74), S(77), S(81), S(84),
+	S(88), S(91), S(95), S(99), S(103), S(107), S(111), S(115),
+	S(119), S(124), S(128), S(132), S(137), S(141), S(146), S(151),
+	S(155), S(160), S(165), S(170), S(175), S(180), S(186), S(191),
+	S(196), S(202), S(207), S(213), S(218), S(224), S(230), S(236),
+	S(241), S(247), S(253), S(259), S(266), S(272), S(278), S(285),
+	S(291), S(297), S(304), S(311), S(317), S(324), S(331), S(338),
+	S(345), S(352), S(359), S(366), S(373), S(380), S(388), S(395),
+	S(403), S(410), S(418), S(425), S(433), S(441), S(449), S(457),
+	S(464), S(472), S(481), S(489), S(497), S(505), S(513), S(522),
+	S(530), S(539), S(547), S(556), S(564), S(573), S(582), S(591),
+	S(599), S(608), S(617), S(626), S(635), S(645), S(654), S(663),
+	S(672), S(682), S(691), S(700), S(710), S(719), S(729), S(739),
+	S(748), S(758), S(768), S(778), S(788), S(798), S(807), S(818),
+	S(828), S(838), S(848), S(858), S(868), S(879), S(889), S(899),
+	S(910), S(920), S(931), S(941), S(952), S(963), S(973), S(984),
+	S(995), S(1005), S(1016), S(1027), S(1038), S(1049), S(1060), S(1071),
+	S(1082), S(1093), S(1104), S(1116), S(1127), S(1138), S(1149), S(1161),
+	S(1172), S(1183), S(1195), S(1206), S(1218), S(1229), S(1241), S(1252),
+	S(1264), S(1275), S(1287), S(1299), S(1310), S(1322), S(1334), S(1346),
+	S(1358), S(1369), S(1381), S(1393), S(1405), S(1417), S(1429), S(1441),
+	S(1453), S(1465), S(1477), S(1489), S(1501), S(1513), S(1526), S(1538),
+	S(1550), S(1562), S(1574), S(1587), S(1599), S(1611), S(1623), S(1636),
+	S(1648), S(1660), S(1673), S(1685), S(1697), S(1710), S(1722), S(1735),
+	S(1747), S(1759), S(1772), S(1784), S(1797), S(1809), S(1822), S(1834),
+	S(1847), S(1859), S(1872), S(1884), S(1897), S(1909), S(1922), S(1934),
+	S(1947), S(1960), S(1972), S(1985), S(1997), S(2010), S(2022), S(2035)
+};
+
+static const sample_t SawTooth64[64] =
+{
+	S(0), S(63), S(127), S(191), S(255), S(319), S(383), S(447),
+	S(511), S(575), S(639), S(703), S(767), S(831), S(895), S(959),
+	S(1023), S(1087), S(1151), S(1215), S(1279), S(1343), S(1407), S(1471),
+	S(1535), S(1599), S(1663), S(1727), S(1791), S(1855), S(1919), S(1983),
+	S(2047), S(2111), S(2175), S(2239), S(2303), S(2367), S(2431), S(2495),
+	S(2559), S(2623), S(2687), S(2751), S(2815), S(2879), S(2943), S(3007),
+	S(3071), S(3135), S(3199), S(3263), S(3327), S(3391), S(3455), S(3519),
+	S(3583), S(3647), S(3711), S(3775), S(3839), S(3903), S(3967), S(4031)
+};
+
+static const sample_t SawTooth128[128] =
+{
+	S(0), S(31), S(63), S(95), S(127), S(159), S(191), S(223),
+	S(255), S(287), S(319), S(351), S(383), S(415), S(447), S(479),
+	S(511), S(543), S(575), S(607), S(639), S(671), S(703), S(735),
+	S(767), S(799), S(831), S(863), S(895), S(927), S(959), S(991),
+	S(1023), S(1055), S(1087), S(1119), S(1151), S(1183), S(1215), S(1247),
+	S(1279), S(1311), S(1343), S(1375), S(1407), S(1439), S(1471), S(1503),
+	S(1535), S(1567), S(1599), S(1631), S(1663), S(1695), S(1727), S(1759),
+	S(1791), S(1823), S(1855), S(1887), S(1919), S(1951), S(1983), S(2015),
+	S(2047), S(2079), S(2111), S(2143), S(2175), S(2207), S(2239), S(2271),
+	S(2303), S(2335), S(2367), S(2399), S(2431), S(2463), S(2495), S(2527),
+	S(2559), S(2591), S(2623), S(2655), S(2687), S(2719), S(2751), S(2783),
+	S(2815), S(2847), S(2879), S(2911), S(2943), S(2975), S(3007), S(3039),
+	S(3071), S(3103), S(3135), S(3167), S(3199), S(3231), S(3263), S(3295),
+	S(3327), S(3359), S(3391), S(3423), S(3455), S(3487), S(3519), S(3551),
+	S(3583), S(3615), S(3647), S(3679), S(3711), S(3743), S(3775), S(3807),
+	S(3839), S(3871), S(3903), S(3935), S(3967), S(3999), S(4031), S(4063)
+};
+
+static const sample_t SawTooth256[256] =
+{
+	S(0), S(15), S(31), S(47), S(63), S(79), S(95), S(111),
+	S(127), S(143), S(159), S(175), S(191), S(207), S(223), S(239),
+	S(255), S(271), S(287), S(303), S(319), S(335), S(351), S(367),
+	S(383), S(399), S(415), S(431), S(447), S(463), S(479), S(495),
+	S(511), S(527), S(543), S(559), S(575), S(591), S(607), S(623),
+	S(639), S(655), S(671), S(687), S(703), S(719), S(735), S(751),
+	S(767), S(783), S(799), S(815), S(831), S(847), S(863), S(879),
+	S(895), S(911), S(927), S(943), S(959), S(975), S(991), S(1007),
+	S(1023), S(1039), S(1055), S(1071), S(1087), S(1103), S(1119), S(1135),
+	S(1151), S(1167), S(1183), S(1199), S(1215), S(1231), S(1247), S(1263),
+	S(1279), S(1295), S(1311), S(1327), S(1343), S(1359), S(1375), S(1391),
+	S(1407), S(1423), S(1439), S(1455), S(1471), S(1487), S(1503), S(1519),
+	S(1535), S(1551), S(1567), S(1583), S(1599), S(1615), S(1631), S(1647),
+	S(1663), S(1679), S(1695), S(1711), S(1727), S(1743), S(1759), S(1775),
+	S(1791), S(1807), S(1823), S(1839), S(1855), S(1871), S(1887), S(1903),
+	S(1919), S(1935), S(1951), S(1967), S(1983), S(1999), S(2015), S(2031),
+	S(2047), S(2063), S(2079), S(2095), S(2111), S(2127), S(2143), S(2159),
+	S(2175), S(2191), S(2207), S(2223), S(2239), S(2255), S(2271), S(2287),
+	S(2303), S(2319), S(2335), S(2351), S(2367), S(2383), S(2399), S(2415),
+	S(2431), S(2447), S(2463), S(2479), S(2495), S(2511), S(2527), S(2543),
+	S(2559), S(2575), S(2591), S(2607), S(2623), S(2639), S(2655), S(2671),
+	S(2687), S(2703), S(2719), S(2735), S(2751), S(2767), S(2783), S(2799),
+	S(2815), S(2831), S(2847), S(2863), S(2879), S(2895), S(2911), S(2927),
+	S(2943), S(2959), S(2975), S(2991), S(3007), S(3023), S(3039), S(3055),
+	S(3071), S(3087), S(3103), S(3119), S(3135), S(3151), S(3167), S(3183),
+	S(3199), S(3215), S(3231), S(3247), S(3263), S(3279), S(3295), S(3311),
+	S(3327), S(3343), S(3359), S(3375), S(3391), S(3407), S(3423), S(3439),
+	S(3455), S(3471), S(3487), S(3503), S(3519), S(3535), S(3551), S(3567),
+	S(3583), S(3599), S(3615), S(3631), S(3647), S(3663), S(3679), S(3695),
+	S(3711), S(3727), S(3743), S(3759), S(3775), S(3791), S(3807), S(3823),
+	S(3839), S(3855), S(3871), S(3887), S(3903), S(3919), S(3935), S(3951),
+	S(3967), S(3983), S(3999), S(4015), S(4031), S(4047), S(4063), S(4079)
+};
+
+static const sample_t SawTooth512[512] =
+{
+	S(0), S(7), S(15), S(23), S(31), S(39), S(47), S(55),
+	S(63), S(71), S(79), S(87), S(95), S(103), S(111), S(119),
+	S(127), S(135), S(143), S(151), S(159), S(167), S(175), S(183),
+	S(191), S(199), S(207), S(215), S(223), S(231), S(239), S(247),
+	S(255), S(263), S(271), S(279), S(287), S(295), S(303), S(311),
+	S(319), S(327), S(335), S(343), S(351), S(359), S(367), S(375),
+	S(383), S(391), S(399), S(407), S(415), S(423), S(431), S(439),
+	S(447), S(455), S(463), S(471), S(479), S(487), S(495), S(503),
+	S(511), S(519), S(527), S(535), S(543), S(551), S(559), S(567),
+	S(575), S(583), S(591), S(599), S(607), S(615), S(623), S(631),
+	S(639), S(647), S(655), S(663), S(671), S(679), S(687), S(695),
+	S(703), S(711), S(719), S(727), S(735), S(743), S(751), S(759),
+	S(767), S(775), S(783), S(791), S(799), S(807), S(815), S(823),
+	S(831), S(839), S(847), S(855), S(863), S(871), S(879), S(887),
+	S(895), S(903), S(911), S(919), S(927), S(935), S(943), S(951),
+	S(959), S(967), S(975), S(983), S(991), S(999), S(1007), S(1015),
+	S(1023), S(1031), S(1039), S(1047), S(1055), S(1063), S(1071), S(1079),
+	S(1087), S(1095), S(1103), S(1111), S(1119), S(1127), S(1135), S(1143),
+	S(1151), S(1159), S(1167), S(1175), S(1183), S(1191), S(1199), S(1207),
+	S(1215), S(1223), S(1231), S(1239), S(1247), S(1255), S(1263), S(1271),
+	S(1279), S(1287), S(1295), S(1303), S(1311), S(1319), S(1327), S(1335),
+	S(1343), S(1351), S(1359), S(1367), S(1375), S(1383), S(1391), S(1399),
+	S(1407), S(1415), S(1423), S(1431), S(1439), S(1447), S(1455), S(1463),
+	S(1471), S(1479), S(1487), S(1495), S(1503), S(1511), S(1519), S(1527),
+	S(1535), S(1543), S(1551), S(1559), S(1567), S(1575), S(1583), S(1591),
+	S(1599), S(1607), S(1615), S(1623), S(1631), S(1639), S(1647), S(1655),
+	S(1663), S(1671), S(1679), S(1687), S(1695), S(1703), S(1711), S(1719),
+	S(1727), S(1735), S(1743), S(1751), S(1759), S(1767), S(1775), S(1783),
+	S(1791), S(1799), S(1807), S(1815), S(1823), S(1831), S(1839), S(1847),
+	S(1855), S(1863), S(1871), S(1879), S(1887), S(1895), S(1903), S(1911),
+	S(1919), S(1927), S(1935), S(1943), S(1951), S(1959), S(1967), S(1975),
+	S(1983), S(1991), S(1999), S(2007), S(2015), S(2023), S(2031), S(2039),
+	S(2047), S(2055), S(2063), S(2071), S(2079), S(2087), S(2095), S(2103),
+	S(2111), S(2119), S(2127), S(2135), S(2143), S(2151), S(2159), S(2167),
+	S(2175), S(2183), S(2191), S(2199), S(2207), S(2215), S(2223), S(2231),
+	S(2239), S(2247), S(2255), S(2263), S(2271), S(2279), S(2287), S(2295),
+	S(2303), S(2311), S(2319), S(2327), S(2335), S(2343), S(2351), S(2359),
+	S(2367), S(2375), S(2383), S(2391), S(2399), S(2407), S(2415), S(2423),
+	S(2431), S(2439), S(2447), S(2455), S(2463), S(2471), S(2479), S(2487),
+	S(2495), S(2503), S(2511), S(2519), S(2527), S(2535), S(2543), S(2551),
+	S(2559), S(2567), S(2575), S(2583), S(2591), S(2599), S(2607), S(2615),
+	S(2623), S(2631), S(2639), S(2647), S(2655), S(2663), S(2671), S(2679),
+	S(2687), S(2695), S(2703), S(2711), S(2719), S(2727), S(2735), S(2743),
+	S(2751), S(2759), S(2767), S(2775), S(2783), S(2791), S(2799), S(2807),
+	S(2815), S(2823), S(2831), S(2839), S(2847), S(2855), S(2863), S(2871),
+	S(2879), S(2887), S(2895), S(2903), S(2911), S(2919), S(2927), S(2935),
+	S(2943), S(2951), S(2959), S(2967), S(2975), S(2983), S(2991), S(2999),
+	S(3007), S(3015), S(3023), S(3031), S(3039), S(3047), S(3055), S(3063),
+	S(3071), S(3079), S(3087), S(3095), S(3103), S(3111), S(3119), S(3127),
+	S(3135), S(3143), S(3151), S(3159), S(3167), S(3175), S(3183), S(3191),
+	S(3199), S(3207), S(3215), S(3223), S(3231), S(3239), S(3247), S(3255),
+	S(3263), S(3271), S(3279), S(3287), S(3295), S(3303), S(3311), S(3319),
+	S(3327), S(3335), S(3343), S(3351), S(3359), S(3367), S(3375), S(3383),
+	S(3391), S(3399), S(3407), S(3415), S(3423), S(3431), S(3439), S(3447),
+	S(3455), S(3463), S(3471), S(3479), S(3487), S(3495), S(3503), S(3511),
+	S(3519), S(3527), S(3535), S(3543), S(3551), S(3559), S(3567), S(3575),
+	S(3583), S(3591), S(3599), S(3607), S(3615), S(3623), S(3631), S(3639),
+	S(3647), S(3655), S(3663), S(3671), S(3679), S(3687), S(3695), S(3703),
+	S(3711), S(3719), S(3727), S(3735), S(3743), S(3751), S(3759), S(3767),
+	S(3775), S(3783), S(3791), S(3799), S(3807), S(3815), S(3823), S(3831),
+	S(3839), S(3847), S(3855), S(3863), S(3871), S(3879), S(3887), S(3895),
+	S(3903), S(3911), S(3919), S(3927), S(3935), S(3943), S(3951), S(3959),
+	S(3967), S(3975), S(3983), S(3991), S(3999), S(4007), S(4015), S(4023),
+	S(4031), S(4039), S(4047), S(4055), S(4063), S(4071), S(4079), S(4087)
+};
+
+static const sample_t SawTooth1024[1024] =
+{
+	S(0), S(3), S(7), S(11), S(15), S(19), S(23), S(27),
+	S(31), S(35), S(39), S(43), S(47), S(51), S(55), S(59),
+	S(63), S(67), S(71), S(75), S(79), S(83), S(87), S(91),
+	S(95), S(99), S(103), S(107), S(111), S(115), S(119), S(123),
+	S(127), S(131), S(135), S(139), S(143), S(147), S(151), S(155),
+	S(159), S(163), S(167), S(171), S(175), S(179), S(183), S(187),
+	S(191), S(195), S(199), S(203), S(207), S(211), S(215), S(219),
+	S(223), S(227), S(231), S(235), S(239), S(243), S(247), S(251),
+	S(255), S(259), S(263), S(267), S(271), S(275), S(279), S(283),
+	S(287), S(291), S(295), S(299), S(303), S(307), S(311), S(315),
+	S(319), S(323), S(327), S(331), S(335), S(339), S(343), S(347),
+	S(351), S(355), S(359), S(363), S(367), S(371), S(375), S(379),
+	S(383), S(387), S(391), S(395), S(399), S(403), S(407), S(411),
+	S(415), S(419), S(423), S(427), S(431), S(435), S(439), S(443),
+	S(447), S(451), S(455), S(459), S(463), S(467), S(471), S(475),
+	S(479), S(483), S(487), S(491), S(495), S(499), S(503), S(507),
+	S(511), S(515), S(519), S(523), S(527), S(531), S(535), S(539),
+	S(543), S(547), S(551), S(555), S(559), S(563), S(567), S(571),
+	S(575), S(579), S(583), S(587), S(591), S(595), S(599), S(603),
+	S(607), S(611), S(615), S(619), S(623), S(627), S(631), S(635),
+	S(639), S(643), S(647), S(651), S(655), S(659), S(663), S(667),
+	S(671), S(675), S(679), S(683), S(687), S(691), S(695), S(699),
+	S(703), S(707), S(711), S(715), S(719), S(723), S(727), S(731),
+	S(735), S(739), S(743), S(747), S(751), S(755), S(759), S(763),
+	S(767), S(771), S(775), S(779), S(783), S(787), S(791), S(795),
+	S(799), S(803), S(807), S(811), S(815), S(819), S(823), S(827),
+	S(831), S(835), S(839), S(843), S(847), S(851), S(855), S(859),
+	S(863), S(867), S(871), S(875), S(879), S(883), S(887), S(891),
+	S(895), S(899), S(903), S(907), S(911), S(915), S(919), S(923),
+	S(927), S(931), S(935), S(939), S(943), S(947), S(951), S(955),
+	S(959), S(963), S(967), S(971), S(975), S(979), S(983), S(987),
+	S(991), S(995), S(999), S(1003), S(1007), S(1011), S(1015), S(1019),
+	S(1023), S(1027), S(1031), S(1035), S(1039), S(1043), S(1047), S(1051),
+	S(1055), S(1059), S(1063), S(1067), S(1071), S(1075), S(1079), S(1083),
+	S(1087), S(1091), S(1095), S(1099), S(1103), S(1107), S(1111), S(1115),
+	S(1119), S(1123), S(1127), S(1131), S(1135), S(1139), S(1143), S(1147),
+	S(1151), S(1155), S(1159), S(1163), S(1167), S(1171), S(1175), S(1179),
+	S(1183), S(1187), S(1191), S(1195), S(1199), S(1203), S(1207), S(1211),
+	S(1215), S(1219), S(1223), S(1227), S(1231), S(1235), S(1239), S(1243),
+	S(1247), S(1251), S(1255), S(1259), S(1263), S(1267), S(1271), S(1275),
+	S(1279), S(1283), S(1287), S(1291), S(1295), S(1299), S(1303), S(1307),
+	S(1311), S(1315), S(1319), S(1323), S(1327), S(1331), S(1335), S(1339),
+	S(1343), S(1347), S(1351), S(1355), S(1359), S(1363), S(1367), S(1371),
+	S(1375), S(1379), S(1383), S(1387), S(1391), S(1395), S(1399), S(1403),
+	S(1407), S(1411), S(1415), S(1419), S(1423), S(1427), S(1431), S(1435),
+	S(1439), S(1443), S(1447), S(1451), S(1455), S(1459), S(1463), S(1467),
+	S(1471), S(1475), S(1479), S(1483), S(1487), S(1491), S(1495), S(1499),
+	S(1503), S(1507), S(1511), S(1515), S(1519), S(1523), S(1527), S(1531),
+	S(1535), S(1539), S(1543), S(1547), S(1551), S(1555), S(1559), S(1563),
+	S(1567), S(1571), S(1575), S(1579), S(1583), S(1587), S(1591), S(1595),
+	S(1599), S(1603), S(1607), S(1611), S(1615), S(1619), S(1623), S(1627),
+	S(1631), S(1635), S(1639), S(1643), S(1647), S(1651), S(1655), S(1659),
+	S(1663), S(1667), S(1671), S(1675), S(1679), S(1683), S(1687), S(1691),
+	S(1695), S(1699), S(1703), S(1707), S(1711), S(1715), S(1719), S(1723),
+	S(1727), S(1731), S(1735), S(1739), S(1743), S(1747), S(1751), S(1755),
+	S(1759), S(1763), S(1767), S(1771), S(1775), S(1779), S(1783), S(1787),
+	S(1791), S(1795), S(1799), S(1803), S(1807), S(1811), S(1815), S(1819),
+	S(1823), S(1827), S(1831), S(1835), S(1839), S(1843), S(1847), S(1851),
+	S(1855), S(1859), S(1863), S(1867), S(1871), S(1875), S(1879), S(1883),
+	S(1887), S(1891), S(1895), S(1899), S(1903), S(1907), S(1911), S(1915),
+	S(1919), S(1923), S(1927), S(1931), S(1935), S(1939), S(1943), S(1947),
+	S(1951), S(1955), S(1959), S(1963), S(1967), S(1971), S(1975), S(1979),
+	S(1983), S(1987), S(1991), S(1995), S(1999), S(2003), S(2007), S(2011),
+	S(2015), S(2019), S(2023), S(2027), S(2031), S(2035), S(2039), S(2043),
+	S(2047), S(2051), S(2055), S(2059), S(2063), S(2067), S(2071), S(2075),
+	S(2079), S(2083), S(2087), S(2091), S(2095), S(2099), S(2103), S(2107),
+	S(2111), S(2115), S(2119), S(2123), S(2127), S(2131), S(2135), S(2139),
+	S(2143), S(2147), S(2151), S(2155), S(2159), S(2163), S(2167), S(2171),
+	S(2175), S(2179), S(2183), S(2187), S(2191), S(2195), S(2199), S(2203),
+	S(2207), S(2211), S(2215), S(2219), S(2223), S(2227), S(2231), S(2235),
+	S(2239), S(2243), S(2247), S(2251), S(2255), S(2259), S(2263), S(2267),
+	S(2271), S(2275), S(2279), S(2283), S(2287), S(2291), S(2295), S(2299),
+	S(2303), S(2307), S(2311), S(2315), S(2319), S(2323), S(2327), S(2331),
+	S(2335), S(2339), S(2343), S(2347), S(2351), S(2355), S(2359), S(2363),
+	S(2367), S(2371), S(2375), S(2379), S(2383), S(2387), S(2391), S(2395),
+	S(2399), S(2403), S(2407), S(2411), S(2415), S(2419), S(2423), S(2427),
+	S(2431), S(2435), S(2439), S(2443), S(2447), S(2451), S(2455), S(2459),
+	S(2463), S(2467), S(2471), S(2475), S(2479), S(2483), S(2487), S(2491),
+	S(2495), S(2499), S(2503), S(2507), S(2511), S(2515), S(2519), S(2523),
+	S(2527), S(2531), S(2535), S(2539), S(2543), S(2547), S(2551), S(2555),
+	S(2559), S(2563), S(2567), S(2571), S(2575), S(2579), S(2583), S(2587),
+	S(2591), S(2595), S(2599), S(2603), S(2607), S(2611), S(2615), S(2619),
+	S(2623), S(2627), S(2631), S(2635), S(2639), S(2643), S(2647), S(2651),
+	S(2655), S(2659), S(2663), S(2667), S(2671), S(2675), S(2679), S(2683),
+	S(2687), S(2691), S(2695), S(2699), S(2703), S(2707), S(2711), S(2715),
+	S(2719), S(2723), S(2727), S(2731), S(2735), S(2739), S(2743), S(2747),
+	S(2751), S(2755), S(2759), S(2763), S(2767), S(2771), S(2775), S(2779),
+	S(2783), S(2787), S(2791), S(2795), S(2799), S(2803), S(2807), S(2811),
+	S(2815), S(2819), S(2823), S(2827), S(2831), S(2835), S(2839), S(2843),
+	S(2847), S(2851), S(2855), S(2859), S(2863), S(2867), S(2871), S(2875),
+	S(2879), S(2883), S(2887), S(2891), S(2895), S(2899), S(2903), S(2907),
+	S(2911), S(2915), S(2919), S(2923), S(2927), S(2931), S(2935), S(2939),
+	S(2943), S(2947), S(2951), S(2955), S(2959), S(2963), S(2967), S(2971),
+	S(2975), S(2979), S(2983), S(2987), S(2991), S(2995), S(2999), S(3003),
+	S(3007), S(3011), S(3015), S(3019), S(3023), S(3027), S(3031), S(3035),
+	S(3039), S(3043), S(3047), S(3051), S(3055), S(3059), S(3063), S(3067),
+	S(3071), S(3075), S(3079), S(3083), S(3087), S(3091), S(3095), S(3099),
+	S(3103), S(3107), S(3111), S(3115), S(3119), S(3123), S(3127), S(3131),
+	S(3135), S(3139), S(3143), S(3147), S(3151), S(3155), S(3159), S(3163),
+	S(3167), S(3171), S(3175), S(3179), S(3183), S(3187), S(3191), S(3195),
+	S(3199), S(3203), S(3207), S(3211), S(3215), S(3219), S(3223), S(3227),
+	S(3231), S(3235), S(3239), S(3243), S(3247), S(3251), S(3255), S(3259),
+	S(3263), S(3267), S(3271), S(3275), S(3279), S(3283), S(3287), S(3291),
+	S(3295), S(3299), S(3303), S(3307), S(3311), S(3315), S(3319), S(3323),
+	S(3327), S(3331), S(3335), S(3339), S(3343), S(3347), S(3351), S(3355),
+	S(3359), S(3363), S(3367), S(3371), S(3375), S(3379), S(3383), S(3387),
+	S(3391), S(3395), S(3399), S(3403), S(3407), S(3411), S(3415), S(3419),
+	S(3423), S(3427), S(3431), S(3435), S(3439), S(3443), S(3447), S(3451),
+	S(3455), S(3459), S(3463), S(3467), S(3471), S(3475), S(3479), S(3483),
+	S(3487), S(3491), S(3495), S(3499), S(3503), S(3507), S(3511), S(3515),
+	S(3519), S(3523), S(3527), S(3531), S(3535), S(3539), S(3543), S(3547),
+	S(3551), S(3555), S(3559), S(3563), S(3567), S(3571), S(3575), S(3579),
+	S(3583), S(3587), S(3591), S(3595), S(3599), S(3603), S(3607), S(3611),
+	S(3615), S(3619), S(3623), S(3627), S(3631), S(3635), S(3639), S(3643),
+	S(3647), S(3651), S(3655), S(3659), S(3663), S(3667), S(3671), S(3675),
+	S(3679), S(3683), S(3687), S(3691), S(3695), S(3699), S(3703), S(3707),
+	S(3711), S(3715), S(3719), S(3723), S(3727), S(3731), S(3735), S(3739),
+	S(3743), S(3747), S(3751), S(3755), S(3759), S(3763), S(3767), S(3771),
+	S(3775), S(3779), S(3783), S(3787), S(3791), S(3795), S(3799), S(3803),
+	S(3807), S(3811), S(3815), S(3819), S(3823), S(3827), S(3831), S(3835),
+	S(3839), S(3843), S(3847), S(3851), S(3855), S(3859), S(3863), S(3867),
+	S(3871), S(3875), S(3879), S(3883), S(3887), S(3891), S(3895), S(3899),
+	S(3903), S(3907), S(3911), S(3915), S(3919), S(3923), S(3927), S(3931),
+	S(3935), S(3939), S(3943), S(3947), S(3951), S(3955), S(3959), S(3963),
+	S(3967), S(3971), S(3975), S(3979), S(3983), S(3987), S(3991), S(3995),
+	S(3999), S(4003), S(4007), S(4011), S(4015), S(4019), S(4023), S(4027),
+	S(4031), S(4035), S(4039), S(4043), S(4047), S(4051), S(4055), S(4059),
+	S(4063), S(4067), S(4071), S(4075), S(4079), S(4083), S(4087), S(4091)
+};
+
+static const sample_t Triangular64[64] =
+{
+	S(0), S(127), S(255), S(383), S(511), S(639), S(767), S(895),
+	S(1023), S(1151), S(1279), S(1407), S(1535), S(1663), S(1791), S(1919),
+	S(2047), S(2175), S(2303), S(2431), S(2559), S(2687), S(2815), S(2943),
+	S(3071), S(3199), S(3327), S(3455), S(3583), S(3711), S(3839), S(3967),
+	S(4095), S(3967), S(3839), S(3711), S(3583), S(3455), S(3327), S(3199),
+	S(3071), S(2943), S(2815), S(2687), S(2559), S(2431), S(2303), S(2175),
+	S(2047), S(1919), S(1791), S(1663), S(1535), S(1407), S(1279), S(1151),
+	S(1023), S(895), S(767), S(639), S(511), S(383), S(255), S(127)
+};
+
+static const sample_t Triangular128[128] =
+{
+	S(0), S(63), S(127), S(191), S(255), S(319), S(383), S(447),
+	S(511), S(575), S(639), S(703), S(767), S(831), S(895), S(959),
+	S(1023), S(1087), S(1151), S(1215), S(1279), S(1343), S(1407), S(1471),
+	S(1535), S(1599), S(1663), S(1727), S(1791), S(1855), S(1919), S(1983),
+	S(2047), S(2111), S(2175), S(2239), S(2303), S(2367), S(2431), S(2495),
+	S(2559), S(2623), S(2687), S(2751), S(2815), S(2879), S(2943), S(3007),
+	S(3071), S(3135), S(3199), S(3263), S(3327), S(3391), S(3455), S(3519),
+	S(3583), S(3647), S(3711), S(3775), S(3839), S(3903), S(3967), S(4031),
+	S(4095), S(4031), S(3967), S(3903), S(3839), S(3775), S(3711), S(3647),
+	S(3583), S(3519), S(3455), S(3391), S(3327), S(3263), S(3199), S(3135),
+	S(3071), S(3007), S(2943), S(2879), S(2815), S(2751), S(2687), S(2623),
+	S(2559), S(2495), S(2431), S(2367), S(2303), S(2239), S(2175), S(2111),
+	S(2047), S(1983), S(1919), S(1855), S(1791), S(1727), S(1663), S(1599),
+	S(1535), S(1471), S(1407), S(1343), S(1279), S(1215), S(1151), S(1087),
+	S(1023), S(959), S(895), S(831), S(767), S(703), S(639), S(575),
+	S(511), S(447), S(383), S(319), S(255), S(191), S(127), S(63)
+};
+
+static const sample_t Triangular256[256] =
+{
+	S(0), S(31), S(63), S(95), S(127), S(159), S(191), S(223),
+	S(255), S(287), S(319), S(351), S(383), S(415), S(447), S(479),
+	S(511), S(543), S(575), S(607), S(639), S(671), S(703), S(735),
+	S(767), S(799), S(831), S(863), S(895), S(927), S(959), S(991),
+	S(1023), S(1055), S(1087), S(1119), S(1151), S(1183), S(1215), S(1247),
+	S(1279), S(1311), S(1343), S(1375), S(1407), S(1439), S(1471), S(1503),
+	S(1535), S(1567), S(1599), S(1631), S(1663), S(1695), S(1727), S(1759),
+	S(1791), S(1823), S(1855), S(1887), S(1919), S(1951), S(1983), S(2015),
+	S(2047), S(2079), S(2111), S(2143), S(2175), S(2207), S(2239), S(2271),
+	S(2303), S(2335), S(2367), S(2399), S(2431), S(2463), S(2495), S(2527),
+	S(2559), S(2591), S(2623), S(2655), S(2687), S(2719), S(2751), S(2783),
+	S(2815), S(2847), S(2879), S(2911), S(2943), S(2975), S(3007), S(3039),
+	S(3071), S(3103), S(3135), S(3167), S(3199), S(3231), S(3263), S(3295),
+	S(3327), S(3359), S(3391), S(3423), S(3455), S(3487), S(3519), S(3551),
+	S(3583), S(3615), S(3647), S(3679), S(3711), S(3743), S(3775), S(3807),
+	S(3839), S(3871), S(3903), S(3935), S(3967), S(3999), S(4031), S(4063),
+	S(4095), S(4063), S(4031), S(3999), S(3967), S(3935), S(3903), S(3871),
+	S(3839), S(3807), S(3775), S(3743), S(3711), S(3679), S(3647), S(3615),
+	S(3583), S(3551), S(3519), S(3487), S(3455), S(3423), S(3391), S(3359),
+	S(3327), S(3295), S(3263), S(3231), S(3199), S(3167), S(3135), S(3103),
+	S(3071), S(3039), S(3007), S(2975), S(2943), S(2911), S(2879), S(2847),
+	S(2815), S(2783), S(2751), S(2719), S(2687), S(2655), S(2623), S(2591),
+	S(2559), S(2527), S(2495), S(2463), S(2431), S(2399), S(2367), S(2335),
+	S(2303), S(2271), S(2239), S(2207), S(2175), S(2143), S(2111), S(2079),
+	S(2047), S(2015), S(1983), S(1951), S(1919), S(1887), S(1855), S(1823),
+	S(1791), S(1759), S(1727), S(1695), S(1663), S(1631), S(1599), S(1567),
+	S(1535), S(1503), S(1471), S(1439), S(1407), S(1375), S(1343), S(1311),
+	S(1279), S(1247), S(1215), S(1183), S(1151), S(1119), S(1087), S(1055),
+	S(1023), S(991), S(959), S(927), S(895), S(863), S(831), S(799),
+	S(767), S(735), S(703), S(671), S(639), S(607), S(575), S(543),
+	S(511), S(479), S(447), S(415), S(383), S(351), S(319), S(287),
+	S(255), S(223), S(191), S(159), S(127), S(95), S(63), S(31)
+};
+
+static const sample_t Triangular512[512] =
+{
+	S(0), S(15), S(31), S(47), S(63), S(79), S(95), S(111),
+	S(127), S(143), S(159), S(175), S(191), S(207), S(223), S(239),
+	S(255), S(271), S(287), S(303), S(319), S(335), S(351), S(367),
+	S(383), S(399), S(415), S(431), S(447), S(463), S(479), S(495),
+	S(511), S(527), S(543), S(559), S(575), S(591), S(607), S(623),
+	S(639), S(655), S(671), S(687), S(703), S(719), S(735), S(751),
+	S(767), S(783), S(799), S(815), S(831), S(847), S(863), S(879),
+	S(895), S(911), S(927), S(943), S(959), S(975), S(991), S(1007),
+	S(1023), S(1039), S(1055), S(1071), S(1087), S(1103), S(1119), S(1135),
+	S(1151), S(1167), S(1183), S(1199), S(1215), S(1231), S(1247), S(1263),
+	S(1279), S(1295), S(1311), S(1327), S(1343), S(1359), S(1375), S(1391),
+	S(1407), S(1423), S(1439), S(1455), S(1471), S(1487), S(1503), S(1519),
+	S(1535), S(1551), S(1567), S(1583), S(1599), S(1615), S(1631), S(1647),
+	S(1663), S(1679), S(1695), S(1711), S(1727), S(1743), S(1759), S(1775),
+	S(1791), S(1807), S(1823), S(1839), S(1855), S(1871), S(1887), S(1903),
+	S(1919), S(1935), S(1951), S(1967), S(1983), S(1999), S(2015), S(2031),
+	S(2047), S(2063), S(2079), S(2095), S(2111), S(2127), S(2143), S(2159),
+	S(2175), S(2191), S(2207), S(2223), S(2239), S(2255), S(2271), S(2287),
+	S(2303), S(2319), S(2335), S(2351), S(2367), S(2383), S(2399), S(2415),
+	S(2431), S(2447), S(2463), S(2479), S(2495), S(2511), S(2527), S(2543),
+	S(2559), S(2575), S(2591), S(2607), S(2623), S(2639), S(2655), S(2671),
+	S(2687), S(2703), S(2719), S(2735), S(2751), S(2767), S(2783), S(2799),
+	S(2815), S(2831), S(2847), S(2863), S(2879), S(2895), S(2911), S(2927),
+	S(2943), S(2959), S(2975), S(2991), S(3007), S(3023), S(3039), S(3055),
+	S(3071), S(3087), S(3103), S(3119), S(3135), S(3151), S(3167), S(3183),
+	S(3199), S(3215), S(3231), S(3247), S(3263), S(3279), S(3295), S(3311),
+	S(3327), S(3343), S(3359), S(3375), S(3391), S(3407), S(3423), S(3439),
+	S(3455), S(3471), S(3487), S(3503), S(3519), S(3535), S(3551), S(3567),
+	S(3583), S(3599), S(3615), S(3631), S(3647), S(3663), S(3679), S(3695),
+	S(3711), S(3727), S(3743), S(3759), S(3775), S(3791), S(3807), S(3823),
+	S(3839), S(3855), S(3871), S(3887), S(3903), S(3919), S(3935), S(3951),
+	S(3967), S(3983), S(3999), S(4015), S(4031), S(4047), S(4063), S(4079),
+	S(4095), S(4079), S(4063), S(4047), S(4031), S(4015), S(3999), S(3983),
+	S(3967), S(3951), S(3935), S(3919), S(3903), S(3887), S(3871), S(3855),
+	S(3839), S(3823), S(3807), S(3791), S(3775), S(3759), S(3743), S(3727),
+	S(3711), S(3695), S(3679), S(3663), S(3647), S(3631), S(3615), S(3599),
+	S(3583), S(3567), S(3551), S(3535), S(3519), S(3503), S(3487), S(3471),
+	S(3455), S(3439), S(3423), S(3407), S(3391), S(3375), S(3359), S(3343),
+	S(3327), S(3311), S(3295), S(3279), S(3263), S(3247), S(3231), S(3215),
+	S(3199), S(3183), S(3167), S(3151), S(3135), S(3119), S(3103), S(3087),
+	S(3071), S(3055), S(3039), S(3023), S(3007), S(2991), S(2975), S(2959),
+	S(2943), S(2927), S(2911), S(2895), S(2879), S(2863), S(2847), S(2831),
+	S(2815), S(2799), S(2783), S(2767), S(2751), S(2735), S(2719), S(2703),
+	S(2687), S(2671), S(2655), S(2639), S(2623), S(2607), S(2591), S(2575),
+	S(2559), S(2543), S(2527), S(2511), S(2495), S(2479), S(2463), S(2447),
+	S(2431), S(2415), S(2399), S(2383), S(2367), S(2351), S(2335), S(2319),
+	S(2303), S(2287), S(2271), S(2255), S(2239), S(2223), S(2207), S(2191),
+	S(2175), S(2159), S(2143), S(2127), S(2111), S(2095), S(2079), S(2063),
+	S(2047), S(2031), S(2015), S(1999), S(1983), S(1967), S(1951), S(1935),
+	S(1919), S(1903), S(1887), S(1871), S(1855), S(1839), S(1823), S(1807),
+	S(1791), S(1775), S(1759), S(1743), S(1727), S(1711), S(1695), S(1679),
+	S(1663), S(1647), S(1631), S(1615), S(1599), S(1583), S(1567), S(1551),
+	S(1535), S(1519), S(1503), S(1487), S(1471), S(1455), S(1439), S(1423),
+	S(1407), S(1391), S(1375), S(1359), S(1343), S(1327), S(1311), S(1295),
+	S(1279), S(1263), S(1247), S(1231), S(1215), S(1199), S(1183), S(1167),
+	S(1151), S(1135), S(1119), S(1103), S(1087), S(1071), S(1055), S(1039),
+	S(1023), S(1007), S(991), S(975), S(959), S(943), S(927), S(911),
+	S(895), S(879), S(863), S(847), S(831), S(815), S(799), S(783),
+	S(767), S(751), S(735), S(719), S(703), S(687), S(671), S(655),
+	S(639), S(623), S(607), S(591), S(575), S(559), S(543), S(527),
+	S(511), S(495), S(479), S(463), S(447), S(431), S(415), S(399),
+	S(383), S(367), S(351), S(335), S(319), S(303), S(287), S(271),
+	S(255), S(239), S(223), S(207), S(191), S(175), S(159), S(143),
+	S(127), S(111), S(95), S(79), S(63), S(47), S(31), S(15)
+};
+
+static const sample_t Triangular1024[1024] =
+{
+	S(0), S(7), S(15), S(23), S(31), S(39), S(47), S(55),
+	S(63), S(71), S(79), S(87), S(95), S(103), S(111), S(119),
+	S(127), S(135), S(143), S(151), S(159), S(167), S(175), S(183),
+	S(191), S(199), S(207), S(215), S(223), S(231), S(239), S(247),
+	S(255), S(263), S(271), S(279), S(287), S(295), S(303), S(311),
+	S(319), S(327), S(335), S(343), S(351), S(359), S(367), S(375),
+	S(383), S(391), S(399), S(407), S(415), S(423), S(431), S(439),
+	S(447), S(455), S(463), S(471), S(479), S(487), S(495), S(503),
+	S(511), S(519), S(527), S(535), S(543), S(551), S(559), S(567),
+	S(575), S(583), S(591), S(599), S(607), S(615), S(623), S(631),
+	S(639), S(647), S(655), S(663), S(671), S(679), S(687), S(695),
+	S(703), S(711), S(719), S(727), S(735), S(743), S(751), S(759),
+	S(767), S(775), S(783), S(791), S(799), S(807), S(815), S(823),
+	S(831), S(839), S(847), S(855), S(863), S(871), S(879), S(887),
+	S(895), S(903), S(911), S(919), S(927), S(935), S(943), S(951),
+	S(959), S(967), S(975), S(983), S(991), S(999), S(1007), S(1015),
+	S(1023), S(1031), S(1039), S(1047), S(1055), S(1063), S(1071), S(1079),
+	S(1087), S(1095), S(1103), S(1111), S(1119), S(1127), S(1135), S(1143),
+	S(1151), S(1159), S(1167), S(1175), S(1183), S(1191), S(1199), S(1207),
+	S(1215), S(1223), S(1231), S(1239), S(1247), S(1255), S(1263), S(1271),
+	S(1279), S(1287), S(1295), S(1303), S(1311), S(1319), S(1327), S(1335),
+	S(1343), S(1351), S(1359), S(1367), S(1375), S(1383), S(1391), S(1399),
+	S(1407), S(1415), S(1423), S(1431), S(1439), S(1447), S(1455), S(1463),
+	S(1471), S(1479), S(1487), S(1495), S(1503), S(1511), S(1519), S(1527),
+	S(1535), S(1543), S(1551), S(1559), S(1567), S(1575), S(1583), S(1591),
+	S(1599), S(1607), S(1615), S(1623), S(1631), S(1639), S(1647), S(1655),
+	S(1663), S(1671), S(1679), S(1687), S(1695), S(1703), S(1711), S(1719),
+	S(1727), S(1735), S(1743), S(1751), S(1759), S(1767), S(1775), S(1783),
+	S(1791), S(1799), S(1807), S(1815), S(1823), S(1831), S(1839), S(1847),
+	S(1855), S(1863), S(1871), S(1879), S(1887), S(1895), S(1903), S(1911),
+	S(1919), S(1927), S(1935), S(1943), S(1951), S(1959), S(1967), S(1975),
+	S(1983), S(1991), S(1999), S(2007), S(2015), S(2023), S(2031), S(2039),
+	S(2047), S(2055), S(2063), S(2071), S(2079), S(2087), S(2095), S(2103),
+	S(2111), S(2119), S(2127), S(2135), S(2143), S(2151), S(2159), S(2167),
+	S(2175), S(2183), S(2191), S(2199), S(2207), S(2215), S(2223), S(2231),
+	S(2239), S(2247), S(2255), S(2263), S(2271), S(2279), S(2287), S(2295),
+	S(2303), S(2311), S(2319), S(2327), S(2335), S(2343), S(2351), S(2359),
+	S(2367), S(2375), S(2383), S(2391), S(2399), S(2407), S(2415), S(2423),
+	S(2431), S(2439), S(2447), S(2455), S(2463), S(2471), S(2479), S(2487),
+	S(2495), S(2503), S(2511), S(2519), S(2527), S(2535), S(2543), S(2551),
+	S(2559), S(2567), S(2575), S(2583), S(2591), S(2599), S(2607), S(2615),
+	S(2623), S(2631), S(2639), S(2647), S(2655), S(2663), S(2671), S(2679),
+	S(2687), S(2695), S(2703), S(2711), S(2719), S(2727), S(2735), S(2743),
+	S(2751), S(2759), S(2767), S(2775), S(2783), S(2791), S(2799), S(2807),
+	S(2815), S(2823), S(2831), S(2839), S(2847), S(2855), S(2863), S(2871),
+	S(2879), S(2887), S(2895), S(2903), S(2911), S(2919), S(2927), S(2935),
+	S(2943), S(2951), S(2959), S(2967), S(2975), S(2983), S(2991), S(2999),
+	S(3007), S(3015), S(3023), S(3031), S(3039), S(3047), S(3055), S(3063),
+	S(3071), S(3079), S(3087), S(3095), S(3103), S(3111), S(3119), S(3127),
+	S(3135), S(3143), S(3151), S(3159), S(3167), S(3175), S(3183), S(3191),
+	S(3199), S(3207), S(3215), S(3223), S(3231), S(3239), S(3247), S(3255),
+	S(3263), S(3271), S(3279), S(3287), S(3295), S(3303), S(3311), S(3319),
+	S(3327), S(3335), S(3343), S(3351), S(3359), S(3367), S(3375), S(3383),
+	S(3391), S(3399), S(3407), S(3415), S(3423), S(3431), S(3439), S(3447),
+	S(3455), S(3463), S(3471), S(3479), S(3487), S(3495), S(3503), S(3511),
+	S(3519), S(3527), S(3535), S(3543), S(3551), S(3559), S(3567), S(3575),
+	S(3583), S(3591), S(3599), S(3607), S(3615), S(3623), S(3631), S(3639),
+	S(3647), S(3655), S(3663), S(3671), S(3679), S(3687), S(3695), S(3703),
+	S(3711), S(3719), S(3727), S(3735), S(3743), S(3751), S(3759), S(3767),
+	S(3775), S(3783), S(3791), S(3799), S(3807), S(3815), S(3823), S(3831),
+	S(3839), S(3847), S(3855), S(3863), S(3871), S(3879), S(3887), S(3895),
+	S(3903), S(3911), S(3919), S(3927), S(3935), S(3943), S(3951), S(3959),
+	S(3967), S(3975), S(3983), S(3991), S(3999), S(4007), S(4015), S(4023),
+	S(4031), S(4039), S(4047), S(4055), S(4063), S(4071), S(4079), S(4087),
+	S(4095), S(4087), S(4079), S(4071), S(4063), S(4055), S(4047), S(4039),
+	S(4031), S(4023), S(4015), S(4007), S(3999), S(3991), S(3983), S(3975),
+	S(3967), S(3959), S(3951), S(3943), S(3935), S(3927), S(3919), S(3911),
+	S(3903), S(3895), S(3887), S(3879), S(3871), S(3863), S(3855), S(3847),
+	S(3839), S(3831), S(3823), S(3815), S(3807), S(3799), S(3791), S(3783),
+	S(3775), S(3767), S(3759), S(3751), S(3743), S(3735), S(3727), S(3719),
+	S(3711), S(3703), S(3695), S(3687), S(3679), S(3671), S(3663), S(3655),
+	S(3647), S(3639), S(3631), S(3623), S(3615), S(3607), S(3599), S(3591),
+	S(3583), S(3575), S(3567), S(3559), S(3551), S(3543), S(3535), S(3527),
+	S(3519), S(3511), S(3503), S(3495), S(3487), S(3479), S(3471), S(3463),
+	S(3455), S(3447), S(3439), S(3431), S(3423), S(3415), S(3407), S(3399),
+	S(3391), S(3383), S(3375), S(3367), S(3359), S(3351), S(3343), S(3335),
+	S(3327), S(3319), S(3311), S(3303), S(3295), S(3287), S(3279), S(3271),
+	S(3263), S(3255), S(3247), S(3239), S(3231), S(3223), S(3215), S(3207),
+	S(3199), S(3191), S(3183), S(3175), S(3167), S(3159), S(3151), S(3143),
+	S(3135), S(3127), S(3119), S(3111), S(3103), S(3095), S(3087), S(3079),
+	S(3071), S(3063), S(3055), S(3047), S(3039), S(3031), S(3023), S(3015),
+	S(3007), S(2999), S(2991), S(2983), S(2975), S(2967), S(2959), S(2951),
+	S(2943), S(2935), S(2927), S(2919), S(2911), S(2903), S(2895), S(2887),
+	S(2879), S(2871), S(2863), S(2855), S(2847), S(2839), S(2831), S(2823),
+	S(2815), S(2807), S(2799), S(2791), S(2783), S(2775), S(2767), S(2759),
+	S(2751), S(2743), S(2735), S(2727), S(2719), S(2711), S(2703), S(2695),
+	S(2687), S(2679), S(2671), S(2663), S(2655), S(2647), S(2639), S(2631),
+	S(2623), S(2615), S(2607), S(2599), S(2591), S(2583), S(2575), S(2567),
+	S(2559), S(2551), S(2543), S(2535), S(2527), S(2519), S(2511), S(2503),
+	S(2495), S(2487), S(2479), S(2471), S(2463), S(2455), S(2447), S(2439),
+	S(2431), S(2423), S(2415), S(2407), S(2399), S(2391), S(2383), S(2375),
+	S(2367), S(2359), S(2351), S(2343), S(2335), S(2327), S(2319), S(2311),
+	S(2303), S(2295), S(2287), S(2279), S(2271), S(2263), S(2255), S(2247),
+	S(2239), S(2231), S(2223), S(2215), S(2207), S(2199), S(2191), S(2183),
+	S(2175), S(2167), S(2159), S(2151), S(2143), S(2135), S(2127), S(2119),
+	S(2111), S(2103), S(2095), S(2087), S(2079), S(2071), S(2063), S(2055),
+	S(2047), S(2039), S(2031), S(2023), S(2015), S(2007), S(1999), S(1991),
+	S(1983), S(1975), S(1967), S(1959), S(1951), S(1943), S(1935), S(1927),
+	S(1919), S(1911), S(1903), S(1895), S(1887), S(1879), S(1871), S(1863),
+	S(1855), S(1847), S(1839), S(1831), S(1823), S(1815), S(1807), S(1799),
+	S(1791), S(1783), S(1775), S(1767), S(1759), S(1751), S(1743), S(1735),
+	S(1727), S(1719), S(1711), S(1703), S(1695), S(1687), S(1679), S(1671),
+	S(1663), S(1655), S(1647), S(1639), S(1631), S(1623), S(1615), S(1607),
+	S(1599), S(1591), S(1583), S(1575), S(1567), S(1559), S(1551), S(1543),
+	S(1535), S(1527), S(1519), S(1511), S(1503), S(1495), S(1487), S(1479),
+	S(1471), S(1463), S(1455), S(1447), S(1439), S(1431), S(1423), S(1415),
+	S(1407), S(1399), S(1391), S(1383), S(1375), S(1367), S(1359), S(1351),
+	S(1343), S(1335), S(1327), S(1319), S(1311), S(1303), S(1295), S(1287),
+	S(1279), S(1271), S(1263), S(1255), S(1247), S(1239), S(1231), S(1223),
+	S(1215), S(1207), S(1199), S(1191), S(1183), S(1175), S(1167), S(1159),
+	S(1151), S(1143), S(1135), S(1127), S(1119), S(1111), S(1103), S(1095),
+	S(1087), S(1079), S(1071), S(1063), S(1055), S(1047), S(1039), S(1031),
+	S(1023), S(1015), S(1007), S(999), S(991), S(983), S(975), S(967),
+	S(959), S(951), S(943), S(935), S(927), S(919), S(911), S(903),
+	S(895), S(887), S(879), S(871), S(863), S(855), S(847), S(839),
+	S(831), S(823), S(815), S(807), S(799), S(791), S(783), S(775),
+	S(767), S(759), S(751), S(743), S(735), S(727), S(719), S(711),
+	S(703), S(695), S(687), S(679), S(671), S(663), S(655), S(647),
+	S(639), S(631), S(623), S(615), S(607), S(599), S(591), S(583),
+	S(575), S(567), S(559), S(551), S(543), S(535), S(527), S(519),
+	S(511), S(503), S(495), S(487), S(479), S(471), S(463), S(455),
+	S(447), S(439), S(431), S(423), S(415), S(407), S(399), S(391),
+	S(383), S(375), S(367), S(359), S(351), S(343), S(335), S(327),
+	S(319), S(311), S(303), S(295), S(287), S(279), S(271), S(263),
+	S(255), S(247), S(239), S(231), S(223), S(215), S(207), S(199),
+	S(191), S(183), S(175), S(167), S(159), S(151), S(143), S(135),
+	S(127), S(119), S(111), S(103), S(95), S(87), S(79), S(71),
+	S(63), S(55), S(47), S(39), S(31), S(23), S(15), S(7)
+};
+
+//indexed by waveform type, then by length bits - FLASH_TABLE_MIN_BITS
+const sample_t* const FlashTables[FLASH_TABLE_SHAPES][FLASH_TABLE_MAX_BITS-FLASH_TABLE_MIN_BITS+1] =
+{
+	{Sine64, Sine128, Sine256, Sine512, Sine1024},
+	{SawTooth64, SawTooth128, SawTooth256, SawTooth512, SawTooth1024},
+	{Triangular64, Triangular128, Triangular256, Triangular512, Triangular1024}
+};
+
+static const sample_t SawToothBand256[1024] =
+{
+	S(2047), S(528), S(0), S(276), S(488), S(337), S(210), S(322),
+	S(419), S(339), S(269), S(341), S(404), S(350), S(302), S(356),
+	S(403), S(362), S(327), S(371), S(408), S(375), S(348), S(385),
+	S(416), S(389), S(366), S(398), S(425), S(402), S(384), S(412),
+	S(436), S(416), S(400), S(426), S(447), S(429), S(416), S(440),
+	S(459), S(443), S(431), S(453), S(471), S(456), S(446), S(467),
+	S(483), S(470), S(461), S(481), S(495), S(483), S(476), S(494),
+	S(508), S(497), S(490), S(508), S(521), S(511), S(505), S(522),
+	S(534), S(524), S(519), S(535), S(547), S(538), S(533), S(549),
+	S(560), S(551), S(548), S(562), S(573), S(565), S(562), S(576),
+	S(586), S(579), S(576), S(590), S(599), S(592), S(590), S(603),
+	S(612), S(606), S(604), S(617), S(626), S(619), S(618), S(630),
+	S(639), S(633), S(632), S(644), S(652), S(647), S(645), S(658),
+	S(666), S(660), S(659), S(671), S(679), S(674), S(673), S(685),
+	S(692), S(687), S(687), S(699), S(706), S(701), S(701), S(712),
+	S(719), S(715), S(715), S(726), S(732), S(728), S(729), S(739),
+	S(746), S(742), S(742), S(753), S(759), S(756), S(756), S(767),
+	S(773), S(769), S(770), S(780), S(786), S(783), S(784), S(794),
+	S(800), S(796), S(797), S(807), S(813), S(810), S(811), S(821),
+	S(827), S(824), S(825), S(835), S(840), S(837), S(839), S(848),
+	S(854), S(851), S(852), S(862), S(867), S(864), S(866), S(876),
+	S(881), S(878), S(880), S(889), S(894), S(892), S(894), S(903),
+	S(908), S(905), S(907), S(916), S(921), S(919), S(921), S(930),
+	S(935), S(932), S(935), S(944), S(948), S(946), S(948), S(957),
+	S(962), S(960), S(962), S(971), S(975), S(973), S(976), S(984),
+	S(989), S(987), S(989), S(998), S(1002), S(1001), S(1003), S(1012),
+	S(1016), S(1014), S(1017), S(1025), S(1029), S(1028), S(1031), S(1039),
+	S(1043), S(1041), S(1044), S(1053), S(1056), S(1055), S(1058), S(1066),
+	S(1070), S(1069), S(1072), S(1080), S(1084), S(1082), S(1085), S(1093),
+	S(1097), S(1096), S(1099), S(1107), S(1111), S(1109), S(1113), S(1121),
+	S(1124), S(1123), S(1126), S(1134), S(1138), S(1137), S(1140), S(1148),
+	S(1151), S(1150), S(1154), S(1161), S(1165), S(1164), S(1167), S(1175),
+	S(1178), S(1178), S(1181), S(1189), S(1192), S(1191), S(1195), S(1202),
+	S(1206), S(1205), S(1208), S(1216), S(1219), S(1218), S(1222), S(1229),
+	S(1233), S(1232), S(1236), S(1243), S(1246), S(1246), S(1249), S(1257),
+	S(1260), S(1259), S(1263), S(1270), S(1273), S(1273), S(1277), S(1284),
+	S(1287), S(1286), S(1290), S(1298), S(1301), S(1300), S(1304), S(1311),
+	S(1314), S(1314), S(1318), S(1325), S(1328), S(1327), S(1331), S(1338),
+	S(1341), S(1341), S(1345), S(1352), S(1355), S(1354), S(1359), S(1366),
+	S(1368), S(1368), S(1372), S(1379), S(1382), S(1382), S(1386), S(1393),
+	S(1396), S(1395), S(1399), S(1406), S(1409), S(1409), S(1413), S(1420),
+	S(1423), S(1423), S(1427), S(1434), S(1436), S(1436), S(1440), S(1447),
+	S(1450), S(1450), S(1454), S(1461), S(1463), S(1463), S(1468), S(1475),
+	S(1477), S(1477), S(1481), S(1488), S(1491), S(1491), S(1495), S(1502),
+	S(1504), S(1504), S(1509), S(1515), S(1518), S(1518), S(1522), S(1529),
+	S(1531), S(1531), S(1536), S(1543), S(1545), S(1545), S(1550), S(1556),
+	S(1558), S(1559), S(1563), S(1570), S(1572), S(1572), S(1577), S(1583),
+	S(1586), S(1586), S(1591), S(1597), S(1599), S(1600), S(1604), S(1611),
+	S(1613), S(1613), S(1618), S(1624), S(1626), S(1627), S(1631), S(1638),
+	S(1640), S(1640), S(1645), S(1651), S(1654), S(1654), S(1659), S(1665),
+	S(1667), S(1668), S(1672), S(1679), S(1681), S(1681), S(1686), S(1692),
+	S(1694), S(1695), S(1700), S(1706), S(1708), S(1708), S(1713), S(1720),
+	S(1721), S(1722), S(1727), S(1733), S(1735), S(1736), S(1741), S(1747),
+	S(1749), S(1749), S(1754), S(1760), S(1762), S(1763), S(1768), S(1774),
+	S(1776), S(1776), S(1782), S(1788), S(1789), S(1790), S(1795), S(1801),
+	S(1803), S(1804), S(1809), S(1815), S(1817), S(1817), S(1822), S(1828),
+	S(1830), S(1831), S(1836), S(1842), S(1844), S(1845), S(1850), S(1856),
+	S(1857), S(1858), S(1863), S(1869), S(1871), S(1872), S(1877), S(1883),
+	S(1884), S(1885), S(1891), S(1897), S(1898), S(1899), S(1904), S(1910),
+	S(1912), S(1913), S(1918), S(1924), S(1925), S(1926), S(1932), S(1937),
+	S(1939), S(1940), S(1945), S(1951), S(1952), S(1953), S(1959), S(1965),
+	S(1966), S(1967), S(1972), S(1978), S(1980), S(1981), S(1986), S(1992),
+	S(1993), S(1994), S(2000), S(2005), S(2007), S(2008), S(2013), S(2019),
+	S(2020), S(2022), S(2027), S(2033), S(2034), S(2035), S(2041), S(2046),
+	S(2047), S(2049), S(2054), S(2060), S(2061), S(2062), S(2068), S(2073),
+	S(2075), S(2076), S(2082), S(2087), S(2088), S(2090), S(2095), S(2101),
+	S(2102), S(2103), S(2109), S(2114), S(2115), S(2117), S(2123), S(2128),
+	S(2129), S(2130), S(2136), S(2142), S(2143), S(2144), S(2150), S(2155),
+	S(2156), S(2158), S(2163), S(2169), S(2170), S(2171), S(2177), S(2182),
+	S(2183), S(2185), S(2191), S(2196), S(2197), S(2198), S(2204), S(2210),
+	S(2211), S(2212), S(2218), S(2223), S(2224), S(2226), S(2232), S(2237),
+	S(2238), S(2239), S(2245), S(2250), S(2251), S(2253), S(2259), S(2264),
+	S(2265), S(2267), S(2273), S(2278), S(2278), S(2280), S(2286), S(2291),
+	S(2292), S(2294), S(2300), S(2305), S(2306), S(2307), S(2313), S(2319),
+	S(2319), S(2321), S(2327), S(2332), S(2333), S(2335), S(2341), S(2346),
+	S(2346), S(2348), S(2354), S(2359), S(2360), S(2362), S(2368), S(2373),
+	S(2374), S(2375), S(2382), S(2387), S(2387), S(2389), S(2395), S(2400),
+	S(2401), S(2403), S(2409), S(2414), S(2414), S(2416), S(2423), S(2427),
+	S(2428), S(2430), S(2436), S(2441), S(2441), S(2444), S(2450), S(2455),
+	S(2455), S(2457), S(2464), S(2468), S(2469), S(2471), S(2477), S(2482),
+	S(2482), S(2484), S(2491), S(2495), S(2496), S(2498), S(2504), S(2509),
+	S(2509), S(2512), S(2518), S(2523), S(2523), S(2525), S(2532), S(2536),
+	S(2537), S(2539), S(2545), S(2550), S(2550), S(2552), S(2559), S(2564),
+	S(2564), S(2566), S(2573), S(2577), S(2577), S(2580), S(2586), S(2591),
+	S(2591), S(2593), S(2600), S(2604), S(2604), S(2607), S(2614), S(2618),
+	S(2618), S(2620), S(2627), S(2632), S(2632), S(2634), S(2641), S(2645),
+	S(2645), S(2648), S(2655), S(2659), S(2659), S(2661), S(2668), S(2672),
+	S(2672), S(2675), S(2682), S(2686), S(2686), S(2689), S(2696), S(2700),
+	S(2699), S(2702), S(2709), S(2713), S(2713), S(2716), S(2723), S(2727),
+	S(2727), S(2729), S(2736), S(2741), S(2740), S(2743), S(2750), S(2754),
+	S(2754), S(2757), S(2764), S(2768), S(2767), S(2770), S(2777), S(2781),
+	S(2781), S(2784), S(2791), S(2795), S(2794), S(2797), S(2805), S(2809),
+	S(2808), S(2811), S(2818), S(2822), S(2822), S(2825), S(2832), S(2836),
+	S(2835), S(2838), S(2846), S(2849), S(2849), S(2852), S(2859), S(2863),
+	S(2862), S(2866), S(2873), S(2877), S(2876), S(2879), S(2887), S(2890),
+	S(2889), S(2893), S(2900), S(2904), S(2903), S(2906), S(2914), S(2917),
+	S(2917), S(2920), S(2928), S(2931), S(2930), S(2934), S(2941), S(2945),
+	S(2944), S(2947), S(2955), S(2958), S(2957), S(2961), S(2969), S(2972),
+	S(2971), S(2974), S(2982), S(2986), S(2984), S(2988), S(2996), S(2999),
+	S(2998), S(3002), S(3010), S(3013), S(3011), S(3015), S(3023), S(3026),
+	S(3025), S(3029), S(3037), S(3040), S(3039), S(3042), S(3051), S(3054),
+	S(3052), S(3056), S(3064), S(3067), S(3066), S(3070), S(3078), S(3081),
+	S(3079), S(3083), S(3092), S(3094), S(3093), S(3097), S(3106), S(3108),
+	S(3106), S(3111), S(3119), S(3122), S(3120), S(3124), S(3133), S(3135),
+	S(3133), S(3138), S(3147), S(3149), S(3147), S(3151), S(3160), S(3163),
+	S(3160), S(3165), S(3174), S(3176), S(3174), S(3179), S(3188), S(3190),
+	S(3187), S(3192), S(3201), S(3203), S(3201), S(3206), S(3215), S(3217),
+	S(3214), S(3219), S(3229), S(3231), S(3228), S(3233), S(3243), S(3244),
+	S(3241), S(3247), S(3256), S(3258), S(3255), S(3260), S(3270), S(3271),
+	S(3268), S(3274), S(3284), S(3285), S(3282), S(3288), S(3298), S(3299),
+	S(3295), S(3301), S(3311), S(3312), S(3309), S(3315), S(3325), S(3326),
+	S(3322), S(3328), S(3339), S(3339), S(3336), S(3342), S(3353), S(3353),
+	S(3349), S(3356), S(3366), S(3367), S(3363), S(3369), S(3380), S(3380),
+	S(3376), S(3383), S(3394), S(3394), S(3389), S(3396), S(3408), S(3408),
+	S(3403), S(3410), S(3422), S(3421), S(3416), S(3424), S(3436), S(3435),
+	S(3429), S(3437), S(3450), S(3448), S(3443), S(3451), S(3463), S(3462),
+	S(3456), S(3465), S(3477), S(3476), S(3469), S(3478), S(3491), S(3489),
+	S(3483), S(3492), S(3505), S(3503), S(3496), S(3505), S(3519), S(3516),
+	S(3509), S(3519), S(3533), S(3530), S(3522), S(3533), S(3547), S(3544),
+	S(3535), S(3546), S(3562), S(3557), S(3548), S(3560), S(3576), S(3571),
+	S(3561), S(3573), S(3590), S(3584), S(3574), S(3587), S(3605), S(3598),
+	S(3587), S(3601), S(3619), S(3612), S(3600), S(3614), S(3634), S(3625),
+	S(3612), S(3628), S(3649), S(3639), S(3624), S(3642), S(3664), S(3652),
+	S(3636), S(3655), S(3679), S(3666), S(3648), S(3669), S(3695), S(3679),
+	S(3659), S(3683), S(3711), S(3693), S(3670), S(3697), S(3729), S(3706),
+	S(3679), S(3710), S(3747), S(3720), S(3687), S(3724), S(3768), S(3733),
+	S(3692), S(3739), S(3793), S(3745), S(3691), S(3754), S(3826), S(3756),
+	S(3676), S(3773), S(3885), S(3758), S(3607), S(3819), S(4095), S(3567)
+};
+
+static const sample_t SawToothBand128[1024] =
+{
+	S(2048), S(1203), S(524), S(118), S(0), S(96), S(282), S(439),
+	S(496), S(449), S(346), S(255), S(225), S(264), S(343), S(414),
+	S(441), S(417), S(362), S(312), S(297), S(324), S(375), S(422),
+	S(440), S(423), S(386), S(353), S(345), S(365), S(404), S(439),
+	S(453), S(440), S(413), S(388), S(383), S(401), S(432), S(460),
+	S(471), S(461), S(439), S(421), S(418), S(433), S(460), S(483),
+	S(492), S(484), S(466), S(451), S(450), S(464), S(487), S(508),
+	S(515), S(509), S(493), S(481), S(481), S(494), S(515), S(533),
+	S(540), S(534), S(521), S(510), S(511), S(523), S(542), S(558),
+	S(564), S(559), S(548), S(539), S(540), S(552), S(570), S(584),
+	S(590), S(585), S(575), S(568), S(570), S(581), S(597), S(610),
+	S(615), S(611), S(602), S(596), S(598), S(609), S(624), S(637),
+	S(641), S(638), S(630), S(625), S(627), S(637), S(652), S(663),
+	S(668), S(664), S(657), S(653), S(655), S(666), S(679), S(690),
+	S(694), S(691), S(684), S(681), S(684), S(694), S(706), S(717),
+	S(720), S(717), S(712), S(708), S(712), S(721), S(734), S(743),
+	S(747), S(744), S(739), S(736), S(740), S(749), S(761), S(770),
+	S(773), S(771), S(766), S(764), S(768), S(777), S(788), S(797),
+	S(800), S(798), S(794), S(792), S(796), S(805), S(816), S(824),
+	S(827), S(825), S(821), S(820), S(824), S(832), S(843), S(851),
+	S(854), S(852), S(848), S(847), S(851), S(860), S(870), S(878),
+	S(881), S(879), S(875), S(875), S(879), S(888), S(898), S(905),
+	S(907), S(906), S(903), S(902), S(907), S(915), S(925), S(932),
+	S(934), S(933), S(930), S(930), S(934), S(943), S(952), S(959),
+	S(961), S(960), S(957), S(958), S(962), S(970), S(980), S(986),
+	S(988), S(987), S(985), S(985), S(990), S(998), S(1007), S(1013),
+	S(1015), S(1014), S(1012), S(1013), S(1017), S(1026), S(1034), S(1040),
+	S(1042), S(1041), S(1039), S(1040), S(1045), S(1053), S(1062), S(1067),
+	S(1069), S(1068), S(1067), S(1068), S(1073), S(1081), S(1089), S(1095),
+	S(1096), S(1095), S(1094), S(1095), S(1100), S(1108), S(1116), S(1122),
+	S(1124), S(1122), S(1121), S(1123), S(1128), S(1136), S(1144), S(1149),
+	S(1151), S(1150), S(1149), S(1150), S(1155), S(1163), S(1171), S(1176),
+	S(1178), S(1177), S(1176), S(1178), S(1183), S(1191), S(1198), S(1203),
+	S(1205), S(1204), S(1203), S(1205), S(1210), S(1218), S(1225), S(1230),
+	S(1232), S(1231), S(1231), S(1232), S(1238), S(1245), S(1253), S(1258),
+	S(1259), S(1258), S(1258), S(1260), S(1265), S(1273), S(1280), S(1285),
+	S(1286), S(1285), S(1285), S(1287), S(1293), S(1300), S(1307), S(1312),
+	S(1313), S(1313), S(1312), S(1315), S(1320), S(1328), S(1335), S(1339),
+	S(1340), S(1340), S(1340), S(1342), S(1348), S(1355), S(1362), S(1366),
+	S(1368), S(1367), S(1367), S(1370), S(1375), S(1383), S(1389), S(1394),
+	S(1395), S(1394), S(1394), S(1397), S(1403), S(1410), S(1417), S(1421),
+	S(1422), S(1422), S(1422), S(1424), S(1430), S(1437), S(1444), S(1448),
+	S(1449), S(1449), S(1449), S(1452), S(1458), S(1465), S(1471), S(1475),
+	S(1476), S(1476), S(1476), S(1479), S(1485), S(1492), S(1499), S(1502),
+	S(1503), S(1503), S(1504), S(1507), S(1513), S(1520), S(1526), S(1530),
+	S(1531), S(1530), S(1531), S(1534), S(1540), S(1547), S(1553), S(1557),
+	S(1558), S(1558), S(1558), S(1562), S(1567), S(1575), S(1581), S(1584),
+	S(1585), S(1585), S(1586), S(1589), S(1595), S(1602), S(1608), S(1611),
+	S(1612), S(1612), S(1613), S(1616), S(1622), S(1629), S(1635), S(1639),
+	S(1639), S(1639), S(1640), S(1644), S(1650), S(1657), S(1663), S(1666),
+	S(1667), S(1667), S(1668), S(1671), S(1677), S(1684), S(1690), S(1693),
+	S(1694), S(1694), S(1695), S(1699), S(1705), S(1712), S(1717), S(1720),
+	S(1721), S(1721), S(1722), S(1726), S(1732), S(1739), S(1745), S(1748),
+	S(1748), S(1748), S(1750), S(1753), S(1760), S(1766), S(1772), S(1775),
+	S(1775), S(1775), S(1777), S(1781), S(1787), S(1794), S(1799), S(1802),
+	S(1803), S(1803), S(1804), S(1808), S(1814), S(1821), S(1826), S(1829),
+	S(1830), S(1830), S(1831), S(1836), S(1842), S(1849), S(1854), S(1856),
+	S(1857), S(1857), S(1859), S(1863), S(1869), S(1876), S(1881), S(1884),
+	S(1884), S(1884), S(1886), S(1890), S(1897), S(1903), S(1908), S(1911),
+	S(1911), S(1912), S(1913), S(1918), S(1924), S(1931), S(1936), S(1938),
+	S(1939), S(1939), S(1941), S(1945), S(1952), S(1958), S(1963), S(1965),
+	S(1966), S(1966), S(1968), S(1973), S(1979), S(1986), S(1990), S(1993),
+	S(1993), S(1993), S(1995), S(2000), S(2006), S(2013), S(2018), S(2020),
+	S(2020), S(2021), S(2023), S(2027), S(2034), S(2040), S(2045), S(2047),
+	S(2048), S(2048), S(2050), S(2055), S(2061), S(2068), S(2072), S(2074),
+	S(2075), S(2075), S(2077), S(2082), S(2089), S(2095), S(2100), S(2102),
+	S(2102), S(2102), S(2105), S(2109), S(2116), S(2122), S(2127), S(2129),
+	S(2129), S(2130), S(2132), S(2137), S(2143), S(2150), S(2154), S(2156),
+	S(2156), S(2157), S(2159), S(2164), S(2171), S(2177), S(2182), S(2183),
+	S(2184), S(2184), S(2187), S(2192), S(2198), S(2205), S(2209), S(2211),
+	S(2211), S(2211), S(2214), S(2219), S(2226), S(2232), S(2236), S(2238),
+	S(2238), S(2239), S(2241), S(2246), S(2253), S(2259), S(2264), S(2265),
+	S(2265), S(2266), S(2269), S(2274), S(2281), S(2287), S(2291), S(2292),
+	S(2292), S(2293), S(2296), S(2301), S(2308), S(2314), S(2318), S(2320),
+	S(2320), S(2320), S(2323), S(2329), S(2335), S(2342), S(2345), S(2347),
+	S(2347), S(2347), S(2350), S(2356), S(2363), S(2369), S(2373), S(2374),
+	S(2374), S(2375), S(2378), S(2383), S(2390), S(2396), S(2400), S(2401),
+	S(2401), S(2402), S(2405), S(2411), S(2418), S(2424), S(2427), S(2428),
+	S(2428), S(2429), S(2432), S(2438), S(2445), S(2451), S(2455), S(2456),
+	S(2456), S(2456), S(2460), S(2466), S(2473), S(2479), S(2482), S(2483),
+	S(2483), S(2484), S(2487), S(2493), S(2500), S(2506), S(2509), S(2510),
+	S(2510), S(2511), S(2514), S(2520), S(2528), S(2533), S(2537), S(2537),
+	S(2537), S(2538), S(2542), S(2548), S(2555), S(2561), S(2564), S(2565),
+	S(2564), S(2565), S(2569), S(2575), S(2582), S(2588), S(2591), S(2592),
+	S(2592), S(2593), S(2596), S(2603), S(2610), S(2616), S(2619), S(2619),
+	S(2619), S(2620), S(2624), S(2630), S(2637), S(2643), S(2646), S(2646),
+	S(2646), S(2647), S(2651), S(2658), S(2665), S(2671), S(2673), S(2673),
+	S(2673), S(2674), S(2678), S(2685), S(2692), S(2698), S(2701), S(2701),
+	S(2700), S(2701), S(2706), S(2712), S(2720), S(2725), S(2728), S(2728),
+	S(2727), S(2729), S(2733), S(2740), S(2747), S(2753), S(2755), S(2755),
+	S(2755), S(2756), S(2760), S(2767), S(2775), S(2780), S(2783), S(2782),
+	S(2782), S(2783), S(2788), S(2795), S(2802), S(2808), S(2810), S(2810),
+	S(2809), S(2810), S(2815), S(2822), S(2830), S(2835), S(2837), S(2837),
+	S(2836), S(2837), S(2842), S(2850), S(2857), S(2863), S(2864), S(2864),
+	S(2863), S(2865), S(2870), S(2877), S(2885), S(2890), S(2892), S(2891),
+	S(2890), S(2892), S(2897), S(2904), S(2912), S(2917), S(2919), S(2918),
+	S(2917), S(2919), S(2924), S(2932), S(2940), S(2945), S(2946), S(2945),
+	S(2944), S(2946), S(2951), S(2959), S(2967), S(2972), S(2974), S(2973),
+	S(2971), S(2973), S(2979), S(2987), S(2995), S(3000), S(3001), S(3000),
+	S(2999), S(3000), S(3006), S(3014), S(3022), S(3027), S(3028), S(3027),
+	S(3026), S(3028), S(3033), S(3042), S(3050), S(3055), S(3056), S(3054),
+	S(3053), S(3055), S(3061), S(3069), S(3078), S(3082), S(3083), S(3081),
+	S(3080), S(3082), S(3088), S(3097), S(3105), S(3110), S(3110), S(3108),
+	S(3107), S(3109), S(3115), S(3125), S(3133), S(3137), S(3138), S(3135),
+	S(3134), S(3136), S(3143), S(3152), S(3161), S(3165), S(3165), S(3162),
+	S(3161), S(3163), S(3170), S(3180), S(3188), S(3193), S(3192), S(3189),
+	S(3188), S(3190), S(3197), S(3207), S(3216), S(3220), S(3220), S(3216),
+	S(3214), S(3217), S(3225), S(3235), S(3244), S(3248), S(3247), S(3243),
+	S(3241), S(3244), S(3252), S(3263), S(3271), S(3275), S(3274), S(3270),
+	S(3268), S(3271), S(3279), S(3290), S(3299), S(3303), S(3301), S(3297),
+	S(3295), S(3298), S(3307), S(3318), S(3327), S(3331), S(3329), S(3324),
+	S(3322), S(3325), S(3334), S(3346), S(3355), S(3359), S(3356), S(3351),
+	S(3348), S(3352), S(3361), S(3374), S(3383), S(3387), S(3383), S(3378),
+	S(3375), S(3378), S(3389), S(3401), S(3411), S(3414), S(3411), S(3404),
+	S(3401), S(3405), S(3416), S(3429), S(3440), S(3442), S(3438), S(3431),
+	S(3427), S(3432), S(3443), S(3458), S(3468), S(3470), S(3465), S(3457),
+	S(3454), S(3458), S(3471), S(3486), S(3497), S(3499), S(3493), S(3484),
+	S(3480), S(3485), S(3498), S(3514), S(3525), S(3527), S(3520), S(3510),
+	S(3505), S(3511), S(3525), S(3543), S(3555), S(3556), S(3547), S(3536),
+	S(3531), S(3537), S(3553), S(3572), S(3584), S(3585), S(3574), S(3561),
+	S(3555), S(3562), S(3580), S(3601), S(3614), S(3614), S(3602), S(3586),
+	S(3580), S(3587), S(3608), S(3631), S(3645), S(3644), S(3629), S(3611),
+	S(3603), S(3612), S(3635), S(3662), S(3677), S(3674), S(3656), S(3634),
+	S(3624), S(3635), S(3663), S(3694), S(3712), S(3707), S(3682), S(3655),
+	S(3642), S(3656), S(3691), S(3730), S(3750), S(3742), S(3709), S(3672),
+	S(3655), S(3673), S(3720), S(3771), S(3798), S(3783), S(3733), S(3678),
+	S(3654), S(3681), S(3752), S(3831), S(3870), S(3840), S(3749), S(3646),
+	S(3599), S(3656), S(3813), S(3999), S(4095), S(3977), S(3571), S(2892)
+};
+
+static const sample_t SawToothBand64[1024] =
+{
+	S(2048), S(1611), S(1198), S(827), S(517), S(277), S(113), S(23),
+	S(0), S(32), S(103), S(196), S(295), S(385), S(456), S(499),
+	S(513), S(500), S(466), S(417), S(364), S(315), S(277), S(256),
+	S(254), S(269), S(300), S(340), S(384), S(425), S(457), S(478),
+	S(485), S(479), S(461), S(436), S(408), S(382), S(363), S(353),
+	S(355), S(367), S(388), S(415), S(444), S(471), S(493), S(506),
+	S(511), S(507), S(495), S(478), S(460), S(444), S(432), S(427),
+	S(430), S(440), S(457), S(478), S(500), S(521), S(537), S(548),
+	S(551), S(548), S(539), S(527), S(514), S(502), S(495), S(492),
+	S(496), S(506), S(520), S(538), S(556), S(573), S(586), S(595),
+	S(597), S(595), S(588), S(579), S(568), S(560), S(555), S(554),
+	S(558), S(568), S(581), S(596), S(612), S(626), S(637), S(644),
+	S(646), S(644), S(639), S(631), S(623), S(617), S(613), S(614),
+	S(618), S(627), S(639), S(653), S(667), S(679), S(689), S(695),
+	S(697), S(695), S(691), S(684), S(678), S(673), S(671), S(672),
+	S(677), S(686), S(697), S(709), S(722), S(733), S(742), S(747),
+	S(749), S(747), S(743), S(738), S(733), S(729), S(728), S(730),
+	S(735), S(744), S(754), S(766), S(777), S(787), S(795), S(799),
+	S(801), S(800), S(796), S(792), S(788), S(785), S(785), S(787),
+	S(793), S(801), S(811), S(822), S(832), S(841), S(848), S(852),
+	S(854), S(853), S(850), S(846), S(843), S(841), S(841), S(844),
+	S(850), S(857), S(867), S(877), S(887), S(896), S(902), S(906),
+	S(907), S(906), S(904), S(900), S(898), S(896), S(897), S(900),
+	S(906), S(914), S(923), S(933), S(942), S(950), S(956), S(959),
+	S(961), S(960), S(957), S(955), S(953), S(952), S(953), S(957),
+	S(963), S(970), S(979), S(989), S(997), S(1005), S(1010), S(1013),
+	S(1014), S(1013), S(1012), S(1009), S(1008), S(1007), S(1009), S(1013),
+	S(1019), S(1026), S(1035), S(1044), S(1052), S(1059), S(1064), S(1067),
+	S(1068), S(1067), S(1066), S(1064), S(1063), S(1063), S(1065), S(1069),
+	S(1075), S(1082), S(1091), S(1099), S(1107), S(1114), S(1119), S(1121),
+	S(1122), S(1121), S(1120), S(1118), S(1118), S(1118), S(1120), S(1125),
+	S(1131), S(1138), S(1147), S(1155), S(1162), S(1169), S(1173), S(1175),
+	S(1176), S(1176), S(1174), S(1173), S(1173), S(1173), S(1176), S(1180),
+	S(1187), S(1194), S(1202), S(1210), S(1217), S(1223), S(1227), S(1230),
+	S(1230), S(1230), S(1229), S(1228), S(1228), S(1229), S(1232), S(1236),
+	S(1242), S(1250), S(1258), S(1265), S(1272), S(1278), S(1282), S(1284),
+	S(1285), S(1284), S(1283), S(1283), S(1283), S(1284), S(1287), S(1292),
+	S(1298), S(1305), S(1313), S(1321), S(1327), S(1333), S(1336), S(1338),
+	S(1339), S(1339), S(1338), S(1337), S(1338), S(1339), S(1343), S(1347),
+	S(1354), S(1361), S(1369), S(1376), S(1382), S(1387), S(1391), S(1393),
+	S(1393), S(1393), S(1392), S(1392), S(1393), S(1395), S(1398), S(1403),
+	S(1409), S(1417), S(1424), S(1431), S(1437), S(1442), S(1445), S(1447),
+	S(1448), S(1447), S(1447), S(1447), S(1448), S(1450), S(1453), S(1459),
+	S(1465), S(1472), S(1480), S(1486), S(1492), S(1497), S(1500), S(1502),
+	S(1502), S(1502), S(1501), S(1502), S(1503), S(1505), S(1509), S(1514),
+	S(1521), S(1528), S(1535), S(1542), S(1547), S(1552), S(1555), S(1556),
+	S(1557), S(1556), S(1556), S(1556), S(1558), S(1560), S(1564), S(1570),
+	S(1576), S(1583), S(1590), S(1597), S(1602), S(1607), S(1609), S(1611),
+	S(1611), S(1611), S(1611), S(1611), S(1613), S(1615), S(1620), S(1625),
+	S(1632), S(1639), S(1646), S(1652), S(1657), S(1661), S(1664), S(1665),
+	S(1666), S(1665), S(1665), S(1666), S(1668), S(1671), S(1675), S(1681),
+	S(1687), S(1694), S(1701), S(1707), S(1712), S(1716), S(1719), S(1720),
+	S(1720), S(1720), S(1720), S(1721), S(1723), S(1726), S(1730), S(1736),
+	S(1743), S(1750), S(1756), S(1762), S(1767), S(1771), S(1773), S(1774),
+	S(1775), S(1775), S(1775), S(1776), S(1778), S(1781), S(1786), S(1791),
+	S(1798), S(1805), S(1812), S(1818), S(1822), S(1826), S(1828), S(1829),
+	S(1829), S(1829), S(1829), S(1830), S(1833), S(1836), S(1841), S(1847),
+	S(1853), S(1860), S(1867), S(1873), S(1877), S(1881), S(1883), S(1884),
+	S(1884), S(1884), S(1884), S(1885), S(1888), S(1891), S(1896), S(1902),
+	S(1909), S(1916), S(1922), S(1928), S(1932), S(1936), S(1937), S(1938),
+	S(1938), S(1938), S(1939), S(1940), S(1943), S(1946), S(1951), S(1958),
+	S(1964), S(1971), S(1978), S(1983), S(1987), S(1990), S(1992), S(1993),
+	S(1993), S(1993), S(1993), S(1995), S(1998), S(2002), S(2007), S(2013),
+	S(2020), S(2027), S(2033), S(2038), S(2042), S(2045), S(2047), S(2047),
+	S(2048), S(2048), S(2048), S(2050), S(2053), S(2057), S(2062), S(2068),
+	S(2075), S(2082), S(2088), S(2093), S(2097), S(2100), S(2102), S(2102),
+	S(2102), S(2102), S(2103), S(2105), S(2108), S(2112), S(2117), S(2124),
+	S(2131), S(2137), S(2144), S(2149), S(2152), S(2155), S(2156), S(2157),
+	S(2157), S(2157), S(2158), S(2159), S(2163), S(2167), S(2173), S(2179),
+	S(2186), S(2193), S(2199), S(2204), S(2207), S(2210), S(2211), S(2211),
+	S(2211), S(2211), S(2212), S(2214), S(2218), S(2222), S(2228), S(2235),
+	S(2242), S(2248), S(2254), S(2259), S(2262), S(2265), S(2266), S(2266),
+	S(2266), S(2266), S(2267), S(2269), S(2273), S(2277), S(2283), S(2290),
+	S(2297), S(2304), S(2309), S(2314), S(2317), S(2319), S(2320), S(2320),
+	S(2320), S(2321), S(2322), S(2324), S(2328), S(2333), S(2339), S(2345),
+	S(2352), S(2359), S(2365), S(2369), S(2372), S(2374), S(2375), S(2375),
+	S(2375), S(2375), S(2376), S(2379), S(2383), S(2388), S(2394), S(2401),
+	S(2408), S(2414), S(2420), S(2424), S(2427), S(2429), S(2430), S(2430),
+	S(2429), S(2430), S(2431), S(2434), S(2438), S(2443), S(2449), S(2456),
+	S(2463), S(2470), S(2475), S(2480), S(2482), S(2484), S(2484), S(2484),
+	S(2484), S(2484), S(2486), S(2488), S(2493), S(2498), S(2505), S(2512),
+	S(2519), S(2525), S(2531), S(2535), S(2537), S(2539), S(2539), S(2539),
+	S(2538), S(2539), S(2540), S(2543), S(2548), S(2553), S(2560), S(2567),
+	S(2574), S(2581), S(2586), S(2590), S(2592), S(2593), S(2594), S(2593),
+	S(2593), S(2593), S(2595), S(2598), S(2603), S(2609), S(2615), S(2623),
+	S(2630), S(2636), S(2642), S(2645), S(2647), S(2648), S(2648), S(2648),
+	S(2647), S(2648), S(2650), S(2653), S(2658), S(2664), S(2671), S(2678),
+	S(2686), S(2692), S(2697), S(2700), S(2702), S(2703), S(2703), S(2702),
+	S(2702), S(2702), S(2704), S(2708), S(2713), S(2719), S(2726), S(2734),
+	S(2741), S(2748), S(2752), S(2756), S(2757), S(2758), S(2757), S(2756),
+	S(2756), S(2757), S(2759), S(2762), S(2768), S(2774), S(2782), S(2790),
+	S(2797), S(2803), S(2808), S(2811), S(2812), S(2812), S(2812), S(2811),
+	S(2810), S(2811), S(2813), S(2817), S(2823), S(2830), S(2837), S(2845),
+	S(2853), S(2859), S(2863), S(2866), S(2867), S(2867), S(2866), S(2865),
+	S(2865), S(2865), S(2868), S(2872), S(2878), S(2885), S(2893), S(2901),
+	S(2908), S(2915), S(2919), S(2922), S(2922), S(2922), S(2921), S(2919),
+	S(2919), S(2920), S(2922), S(2926), S(2933), S(2940), S(2948), S(2957),
+	S(2964), S(2970), S(2975), S(2977), S(2977), S(2977), S(2975), S(2974),
+	S(2973), S(2974), S(2976), S(2981), S(2988), S(2996), S(3004), S(3013),
+	S(3020), S(3026), S(3030), S(3032), S(3032), S(3031), S(3029), S(3028),
+	S(3027), S(3028), S(3031), S(3036), S(3043), S(3051), S(3060), S(3069),
+	S(3076), S(3082), S(3086), S(3088), S(3087), S(3086), S(3083), S(3082),
+	S(3081), S(3082), S(3085), S(3090), S(3098), S(3106), S(3116), S(3125),
+	S(3132), S(3138), S(3142), S(3143), S(3142), S(3140), S(3138), S(3135),
+	S(3134), S(3136), S(3139), S(3145), S(3153), S(3162), S(3172), S(3181),
+	S(3189), S(3195), S(3198), S(3199), S(3197), S(3195), S(3191), S(3189),
+	S(3188), S(3189), S(3193), S(3199), S(3208), S(3218), S(3228), S(3238),
+	S(3245), S(3251), S(3254), S(3254), S(3252), S(3249), S(3245), S(3242),
+	S(3241), S(3243), S(3247), S(3254), S(3263), S(3273), S(3284), S(3294),
+	S(3302), S(3308), S(3310), S(3310), S(3307), S(3303), S(3299), S(3295),
+	S(3294), S(3296), S(3300), S(3308), S(3318), S(3329), S(3341), S(3351),
+	S(3360), S(3365), S(3367), S(3366), S(3362), S(3357), S(3352), S(3348),
+	S(3346), S(3348), S(3353), S(3362), S(3373), S(3386), S(3398), S(3409),
+	S(3418), S(3423), S(3424), S(3422), S(3417), S(3411), S(3404), S(3400),
+	S(3398), S(3400), S(3406), S(3416), S(3428), S(3442), S(3456), S(3468),
+	S(3477), S(3481), S(3482), S(3478), S(3472), S(3464), S(3456), S(3451),
+	S(3449), S(3451), S(3458), S(3469), S(3483), S(3499), S(3514), S(3527),
+	S(3537), S(3541), S(3540), S(3535), S(3527), S(3516), S(3507), S(3500),
+	S(3498), S(3500), S(3509), S(3522), S(3539), S(3557), S(3575), S(3589),
+	S(3599), S(3603), S(3600), S(3593), S(3581), S(3568), S(3556), S(3547),
+	S(3544), S(3547), S(3558), S(3574), S(3595), S(3617), S(3638), S(3655),
+	S(3665), S(3668), S(3663), S(3651), S(3635), S(3617), S(3600), S(3588),
+	S(3584), S(3589), S(3602), S(3624), S(3651), S(3680), S(3707), S(3728),
+	S(3740), S(3742), S(3732), S(3713), S(3687), S(3659), S(3634), S(3616),
+	S(3610), S(3617), S(3638), S(3670), S(3711), S(3755), S(3795), S(3826),
+	S(3841), S(3839), S(3818), S(3780), S(3731), S(3678), S(3629), S(3595),
+	S(3582), S(3596), S(3639), S(3710), S(3800), S(3899), S(3992), S(4063),
+	S(4095), S(4072), S(3982), S(3818), S(3578), S(3268), S(2897), S(2484)
+};
+
+static const sample_t SawToothBand32[1024] =
+{
+	S(2047), S(1825), S(1605), S(1392), S(1187), S(993), S(813), S(648),
+	S(501), S(372), S(262), S(172), S(101), S(49), S(16), S(0),
+	S(0), S(14), S(39), S(75), S(118), S(166), S(217), S(270),
+	S(322), S(371), S(416), S(456), S(489), S(515), S(533), S(544),
+	S(548), S(544), S(535), S(520), S(500), S(478), S(453), S(427),
+	S(402), S(378), S(357), S(338), S(324), S(314), S(309), S(309),
+	S(313), S(323), S(336), S(353), S(373), S(395), S(419), S(443),
+	S(467), S(490), S(511), S(530), S(546), S(558), S(567), S(573),
+	S(574), S(573), S(568), S(560), S(551), S(539), S(527), S(514),
+	S(502), S(491), S(481), S(472), S(467), S(464), S(464), S(466),
+	S(472), S(480), S(491), S(504), S(518), S(534), S(551), S(567),
+	S(584), S(599), S(614), S(626), S(637), S(645), S(651), S(655),
+	S(656), S(655), S(652), S(647), S(641), S(634), S(626), S(618),
+	S(611), S(604), S(599), S(595), S(593), S(592), S(594), S(598),
+	S(604), S(612), S(622), S(633), S(645), S(658), S(671), S(684),
+	S(697), S(709), S(720), S(730), S(738), S(744), S(749), S(751),
+	S(752), S(751), S(749), S(746), S(741), S(736), S(731), S(726),
+	S(721), S(717), S(714), S(713), S(712), S(714), S(717), S(721),
+	S(728), S(735), S(744), S(754), S(765), S(776), S(787), S(799),
+	S(809), S(819), S(828), S(836), S(843), S(848), S(851), S(853),
+	S(854), S(853), S(852), S(849), S(846), S(842), S(839), S(835),
+	S(832), S(830), S(829), S(828), S(829), S(832), S(836), S(841),
+	S(847), S(855), S(863), S(872), S(882), S(892), S(902), S(912),
+	S(921), S(930), S(938), S(944), S(950), S(954), S(957), S(958),
+	S(959), S(958), S(957), S(955), S(953), S(950), S(947), S(945),
+	S(943), S(942), S(942), S(943), S(945), S(948), S(952), S(958),
+	S(964), S(972), S(980), S(989), S(998), S(1007), S(1016), S(1025),
+	S(1033), S(1041), S(1047), S(1053), S(1058), S(1061), S(1064), S(1065),
+	S(1065), S(1065), S(1064), S(1062), S(1061), S(1059), S(1057), S(1056),
+	S(1055), S(1054), S(1055), S(1057), S(1059), S(1063), S(1068), S(1074),
+	S(1080), S(1087), S(1095), S(1104), S(1112), S(1121), S(1129), S(1137),
+	S(1145), S(1151), S(1157), S(1162), S(1166), S(1170), S(1172), S(1173),
+	S(1173), S(1173), S(1172), S(1171), S(1169), S(1168), S(1167), S(1166),
+	S(1166), S(1167), S(1168), S(1170), S(1173), S(1178), S(1183), S(1188),
+	S(1195), S(1202), S(1210), S(1218), S(1226), S(1234), S(1242), S(1249),
+	S(1256), S(1262), S(1268), S(1272), S(1276), S(1278), S(1280), S(1281),
+	S(1281), S(1281), S(1281), S(1280), S(1279), S(1278), S(1277), S(1277),
+	S(1277), S(1279), S(1281), S(1283), S(1287), S(1291), S(1297), S(1303),
+	S(1310), S(1317), S(1324), S(1332), S(1340), S(1347), S(1355), S(1362),
+	S(1368), S(1373), S(1378), S(1382), S(1385), S(1388), S(1389), S(1390),
+	S(1390), S(1390), S(1390), S(1389), S(1388), S(1388), S(1388), S(1388),
+	S(1389), S(1391), S(1393), S(1396), S(1400), S(1405), S(1411), S(1417),
+	S(1424), S(1431), S(1438), S(1446), S(1453), S(1460), S(1467), S(1474),
+	S(1479), S(1485), S(1489), S(1492), S(1495), S(1497), S(1499), S(1499),
+	S(1499), S(1499), S(1499), S(1498), S(1498), S(1498), S(1498), S(1499),
+	S(1500), S(1503), S(1505), S(1509), S(1513), S(1518), S(1524), S(1531),
+	S(1537), S(1544), S(1552), S(1559), S(1566), S(1573), S(1580), S(1586),
+	S(1591), S(1596), S(1600), S(1603), S(1605), S(1607), S(1608), S(1609),
+	S(1609), S(1609), S(1608), S(1608), S(1608), S(1608), S(1609), S(1610),
+	S(1612), S(1614), S(1618), S(1622), S(1626), S(1632), S(1638), S(1644),
+	S(1651), S(1658), S(1665), S(1672), S(1679), S(1686), S(1692), S(1698),
+	S(1703), S(1707), S(1710), S(1713), S(1715), S(1717), S(1718), S(1718),
+	S(1718), S(1718), S(1718), S(1718), S(1718), S(1719), S(1720), S(1721),
+	S(1723), S(1726), S(1730), S(1734), S(1739), S(1745), S(1751), S(1757),
+	S(1764), S(1771), S(1778), S(1785), S(1792), S(1798), S(1804), S(1809),
+	S(1814), S(1818), S(1821), S(1824), S(1826), S(1827), S(1828), S(1828),
+	S(1828), S(1828), S(1828), S(1828), S(1828), S(1829), S(1830), S(1832),
+	S(1835), S(1838), S(1842), S(1847), S(1852), S(1858), S(1864), S(1871),
+	S(1878), S(1885), S(1892), S(1898), S(1905), S(1911), S(1916), S(1921),
+	S(1926), S(1929), S(1932), S(1934), S(1936), S(1937), S(1937), S(1938),
+	S(1938), S(1938), S(1938), S(1938), S(1939), S(1940), S(1941), S(1944),
+	S(1946), S(1950), S(1954), S(1959), S(1965), S(1971), S(1977), S(1984),
+	S(1991), S(1998), S(2005), S(2011), S(2018), S(2023), S(2029), S(2033),
+	S(2037), S(2040), S(2043), S(2045), S(2046), S(2047), S(2047), S(2047),
+	S(2047), S(2048), S(2048), S(2048), S(2049), S(2050), S(2052), S(2055),
+	S(2058), S(2062), S(2066), S(2072), S(2077), S(2084), S(2090), S(2097),
+	S(2104), S(2111), S(2118), S(2124), S(2130), S(2136), S(2141), S(2145),
+	S(2149), S(2151), S(2154), S(2155), S(2156), S(2157), S(2157), S(2157),
+	S(2157), S(2157), S(2158), S(2158), S(2159), S(2161), S(2163), S(2166),
+	S(2169), S(2174), S(2179), S(2184), S(2190), S(2197), S(2203), S(2210),
+	S(2217), S(2224), S(2231), S(2237), S(2243), S(2248), S(2253), S(2257),
+	S(2260), S(2263), S(2265), S(2266), S(2267), S(2267), S(2267), S(2267),
+	S(2267), S(2267), S(2267), S(2268), S(2269), S(2271), S(2274), S(2277),
+	S(2281), S(2286), S(2291), S(2297), S(2303), S(2310), S(2317), S(2324),
+	S(2331), S(2338), S(2344), S(2350), S(2356), S(2361), S(2365), S(2369),
+	S(2372), S(2374), S(2375), S(2376), S(2377), S(2377), S(2377), S(2377),
+	S(2377), S(2377), S(2377), S(2378), S(2380), S(2382), S(2385), S(2388),
+	S(2392), S(2397), S(2403), S(2409), S(2416), S(2423), S(2430), S(2437),
+	S(2444), S(2451), S(2457), S(2463), S(2469), S(2473), S(2477), S(2481),
+	S(2483), S(2485), S(2486), S(2487), S(2487), S(2487), S(2487), S(2486),
+	S(2486), S(2486), S(2487), S(2488), S(2490), S(2492), S(2495), S(2499),
+	S(2504), S(2509), S(2515), S(2522), S(2529), S(2536), S(2543), S(2551),
+	S(2558), S(2564), S(2571), S(2577), S(2582), S(2586), S(2590), S(2592),
+	S(2595), S(2596), S(2597), S(2597), S(2597), S(2597), S(2596), S(2596),
+	S(2596), S(2596), S(2596), S(2598), S(2600), S(2603), S(2606), S(2610),
+	S(2616), S(2621), S(2628), S(2635), S(2642), S(2649), S(2657), S(2664),
+	S(2671), S(2678), S(2684), S(2690), S(2695), S(2699), S(2702), S(2704),
+	S(2706), S(2707), S(2707), S(2707), S(2707), S(2706), S(2705), S(2705),
+	S(2705), S(2705), S(2706), S(2707), S(2710), S(2713), S(2717), S(2722),
+	S(2727), S(2733), S(2740), S(2748), S(2755), S(2763), S(2771), S(2778),
+	S(2785), S(2792), S(2798), S(2804), S(2808), S(2812), S(2814), S(2816),
+	S(2818), S(2818), S(2818), S(2817), S(2816), S(2815), S(2814), S(2814),
+	S(2814), S(2814), S(2815), S(2817), S(2819), S(2823), S(2827), S(2833),
+	S(2839), S(2846), S(2853), S(2861), S(2869), S(2877), S(2885), S(2893),
+	S(2900), S(2907), S(2912), S(2917), S(2922), S(2925), S(2927), S(2928),
+	S(2929), S(2929), S(2928), S(2927), S(2926), S(2924), S(2923), S(2922),
+	S(2922), S(2922), S(2923), S(2925), S(2929), S(2933), S(2938), S(2944),
+	S(2950), S(2958), S(2966), S(2974), S(2983), S(2991), S(3000), S(3008),
+	S(3015), S(3021), S(3027), S(3032), S(3036), S(3038), S(3040), S(3041),
+	S(3040), S(3039), S(3038), S(3036), S(3034), S(3033), S(3031), S(3030),
+	S(3030), S(3030), S(3031), S(3034), S(3037), S(3042), S(3048), S(3054),
+	S(3062), S(3070), S(3079), S(3088), S(3097), S(3106), S(3115), S(3123),
+	S(3131), S(3137), S(3143), S(3147), S(3150), S(3152), S(3153), S(3153),
+	S(3152), S(3150), S(3148), S(3145), S(3142), S(3140), S(3138), S(3137),
+	S(3136), S(3137), S(3138), S(3141), S(3145), S(3151), S(3157), S(3165),
+	S(3174), S(3183), S(3193), S(3203), S(3213), S(3223), S(3232), S(3240),
+	S(3248), S(3254), S(3259), S(3263), S(3266), S(3267), S(3266), S(3265),
+	S(3263), S(3260), S(3256), S(3253), S(3249), S(3246), S(3243), S(3242),
+	S(3241), S(3242), S(3244), S(3247), S(3252), S(3259), S(3267), S(3276),
+	S(3286), S(3296), S(3308), S(3319), S(3330), S(3341), S(3351), S(3360),
+	S(3367), S(3374), S(3378), S(3381), S(3383), S(3382), S(3381), S(3378),
+	S(3374), S(3369), S(3364), S(3359), S(3354), S(3349), S(3346), S(3344),
+	S(3343), S(3344), S(3346), S(3351), S(3357), S(3365), S(3375), S(3386),
+	S(3398), S(3411), S(3424), S(3437), S(3450), S(3462), S(3473), S(3483),
+	S(3491), S(3497), S(3501), S(3503), S(3502), S(3500), S(3496), S(3491),
+	S(3484), S(3477), S(3469), S(3461), S(3454), S(3448), S(3443), S(3440),
+	S(3439), S(3440), S(3444), S(3450), S(3458), S(3469), S(3481), S(3496),
+	S(3511), S(3528), S(3544), S(3561), S(3577), S(3591), S(3604), S(3615),
+	S(3623), S(3629), S(3631), S(3631), S(3628), S(3623), S(3614), S(3604),
+	S(3593), S(3581), S(3568), S(3556), S(3544), S(3535), S(3527), S(3522),
+	S(3521), S(3522), S(3528), S(3537), S(3549), S(3565), S(3584), S(3605),
+	S(3628), S(3652), S(3676), S(3700), S(3722), S(3742), S(3759), S(3772),
+	S(3782), S(3786), S(3786), S(3781), S(3771), S(3757), S(3738), S(3717),
+	S(3693), S(3668), S(3642), S(3617), S(3595), S(3575), S(3560), S(3551),
+	S(3547), S(3551), S(3562), S(3580), S(3606), S(3639), S(3679), S(3724),
+	S(3773), S(3825), S(3878), S(3929), S(3977), S(4020), S(4056), S(4081),
+	S(4095), S(4095), S(4079), S(4046), S(3994), S(3923), S(3833), S(3723),
+	S(3594), S(3447), S(3282), S(3102), S(2908), S(2703), S(2490), S(2270)
+};
+
+static const sample_t SawToothBand16[1024] =
+{
+	S(2047), S(1933), S(1819), S(1706), S(1595), S(1484), S(1376), S(1270),
+	S(1167), S(1066), S(970), S(876), S(787), S(701), S(621), S(544),
+	S(473), S(406), S(344), S(288), S(236), S(190), S(149), S(114),
+	S(83), S(57), S(37), S(21), S(9), S(3), S(0), S(2),
+	S(7), S(16), S(28), S(43), S(61), S(81), S(104), S(128),
+	S(154), S(181), S(209), S(238), S(267), S(297), S(326), S(354),
+	S(382), S(410), S(436), S(461), S(484), S(506), S(526), S(545),
+	S(561), S(576), S(588), S(599), S(608), S(614), S(619), S(622),
+	S(623), S(622), S(619), S(615), S(610), S(603), S(595), S(586),
+	S(576), S(566), S(554), S(543), S(531), S(520), S(508), S(497),
+	S(486), S(475), S(466), S(457), S(449), S(442), S(436), S(431),
+	S(427), S(425), S(424), S(424), S(425), S(428), S(432), S(438),
+	S(444), S(452), S(461), S(470), S(481), S(493), S(505), S(518),
+	S(532), S(546), S(560), S(574), S(589), S(603), S(618), S(632),
+	S(646), S(659), S(672), S(684), S(695), S(706), S(716), S(725),
+	S(733), S(740), S(746), S(751), S(755), S(759), S(761), S(762),
+	S(763), S(762), S(761), S(759), S(756), S(753), S(750), S(745),
+	S(741), S(736), S(731), S(726), S(721), S(716), S(711), S(707),
+	S(703), S(699), S(696), S(693), S(691), S(689), S(688), S(688),
+	S(689), S(691), S(693), S(696), S(700), S(704), S(710), S(716),
+	S(723), S(730), S(738), S(747), S(756), S(766), S(775), S(786),
+	S(796), S(807), S(817), S(828), S(839), S(849), S(860), S(870),
+	S(879), S(889), S(898), S(906), S(914), S(921), S(928), S(934),
+	S(939), S(944), S(948), S(951), S(954), S(956), S(957), S(958),
+	S(959), S(958), S(958), S(956), S(955), S(953), S(951), S(949),
+	S(946), S(943), S(941), S(938), S(936), S(934), S(932), S(930),
+	S(928), S(927), S(927), S(927), S(927), S(928), S(929), S(931),
+	S(934), S(937), S(941), S(945), S(950), S(955), S(961), S(968),
+	S(975), S(982), S(990), S(998), S(1006), S(1015), S(1024), S(1033),
+	S(1042), S(1051), S(1060), S(1068), S(1077), S(1086), S(1094), S(1102),
+	S(1110), S(1117), S(1124), S(1131), S(1137), S(1142), S(1147), S(1152),
+	S(1155), S(1159), S(1162), S(1164), S(1166), S(1168), S(1169), S(1169),
+	S(1169), S(1169), S(1169), S(1168), S(1167), S(1166), S(1165), S(1163),
+	S(1162), S(1161), S(1159), S(1158), S(1157), S(1156), S(1156), S(1156),
+	S(1156), S(1156), S(1157), S(1159), S(1160), S(1163), S(1165), S(1169),
+	S(1172), S(1177), S(1181), S(1186), S(1192), S(1198), S(1204), S(1211),
+	S(1218), S(1225), S(1232), S(1240), S(1248), S(1256), S(1264), S(1272),
+	S(1280), S(1288), S(1296), S(1304), S(1312), S(1319), S(1326), S(1333),
+	S(1339), S(1345), S(1351), S(1356), S(1361), S(1365), S(1369), S(1373),
+	S(1376), S(1378), S(1381), S(1382), S(1384), S(1385), S(1385), S(1386),
+	S(1386), S(1386), S(1386), S(1385), S(1384), S(1384), S(1383), S(1383),
+	S(1382), S(1381), S(1381), S(1381), S(1381), S(1381), S(1382), S(1383),
+	S(1384), S(1386), S(1388), S(1390), S(1393), S(1396), S(1400), S(1404),
+	S(1408), S(1413), S(1418), S(1424), S(1430), S(1436), S(1443), S(1450),
+	S(1457), S(1464), S(1471), S(1479), S(1486), S(1494), S(1501), S(1509),
+	S(1516), S(1524), S(1531), S(1538), S(1544), S(1551), S(1557), S(1563),
+	S(1568), S(1573), S(1578), S(1582), S(1586), S(1590), S(1593), S(1596),
+	S(1598), S(1600), S(1601), S(1603), S(1604), S(1605), S(1605), S(1605),
+	S(1605), S(1605), S(1605), S(1605), S(1605), S(1604), S(1604), S(1604),
+	S(1604), S(1604), S(1604), S(1605), S(1606), S(1607), S(1608), S(1610),
+	S(1612), S(1615), S(1618), S(1621), S(1625), S(1629), S(1633), S(1638),
+	S(1643), S(1648), S(1654), S(1660), S(1666), S(1673), S(1680), S(1686),
+	S(1694), S(1701), S(1708), S(1715), S(1723), S(1730), S(1737), S(1744),
+	S(1751), S(1758), S(1764), S(1770), S(1776), S(1782), S(1787), S(1792),
+	S(1797), S(1801), S(1805), S(1809), S(1812), S(1815), S(1817), S(1819),
+	S(1821), S(1822), S(1824), S(1825), S(1825), S(1826), S(1826), S(1826),
+	S(1826), S(1826), S(1826), S(1826), S(1826), S(1826), S(1826), S(1827),
+	S(1827), S(1828), S(1829), S(1830), S(1831), S(1833), S(1835), S(1838),
+	S(1841), S(1844), S(1848), S(1852), S(1856), S(1861), S(1866), S(1871),
+	S(1877), S(1882), S(1889), S(1895), S(1902), S(1909), S(1915), S(1923),
+	S(1930), S(1937), S(1944), S(1951), S(1958), S(1965), S(1972), S(1978),
+	S(1985), S(1991), S(1997), S(2002), S(2008), S(2013), S(2017), S(2022),
+	S(2026), S(2029), S(2032), S(2035), S(2038), S(2040), S(2042), S(2043),
+	S(2044), S(2045), S(2046), S(2047), S(2047), S(2047), S(2047), S(2047),
+	S(2047), S(2048), S(2048), S(2048), S(2048), S(2048), S(2049), S(2050),
+	S(2051), S(2052), S(2053), S(2055), S(2057), S(2060), S(2063), S(2066),
+	S(2069), S(2073), S(2078), S(2082), S(2087), S(2093), S(2098), S(2104),
+	S(2110), S(2117), S(2123), S(2130), S(2137), S(2144), S(2151), S(2158),
+	S(2165), S(2172), S(2180), S(2186), S(2193), S(2200), S(2206), S(2213),
+	S(2218), S(2224), S(2229), S(2234), S(2239), S(2243), S(2247), S(2251),
+	S(2254), S(2257), S(2260), S(2262), S(2264), S(2265), S(2266), S(2267),
+	S(2268), S(2268), S(2269), S(2269), S(2269), S(2269), S(2269), S(2269),
+	S(2269), S(2269), S(2269), S(2269), S(2270), S(2270), S(2271), S(2273),
+	S(2274), S(2276), S(2278), S(2280), S(2283), S(2286), S(2290), S(2294),
+	S(2298), S(2303), S(2308), S(2313), S(2319), S(2325), S(2331), S(2337),
+	S(2344), S(2351), S(2358), S(2365), S(2372), S(2380), S(2387), S(2394),
+	S(2401), S(2409), S(2415), S(2422), S(2429), S(2435), S(2441), S(2447),
+	S(2452), S(2457), S(2462), S(2466), S(2470), S(2474), S(2477), S(2480),
+	S(2483), S(2485), S(2487), S(2488), S(2489), S(2490), S(2491), S(2491),
+	S(2491), S(2491), S(2491), S(2491), S(2490), S(2490), S(2490), S(2490),
+	S(2490), S(2490), S(2490), S(2490), S(2491), S(2492), S(2494), S(2495),
+	S(2497), S(2499), S(2502), S(2505), S(2509), S(2513), S(2517), S(2522),
+	S(2527), S(2532), S(2538), S(2544), S(2551), S(2557), S(2564), S(2571),
+	S(2579), S(2586), S(2594), S(2601), S(2609), S(2616), S(2624), S(2631),
+	S(2638), S(2645), S(2652), S(2659), S(2665), S(2671), S(2677), S(2682),
+	S(2687), S(2691), S(2695), S(2699), S(2702), S(2705), S(2707), S(2709),
+	S(2711), S(2712), S(2713), S(2714), S(2714), S(2714), S(2714), S(2714),
+	S(2713), S(2712), S(2712), S(2711), S(2711), S(2710), S(2709), S(2709),
+	S(2709), S(2709), S(2710), S(2710), S(2711), S(2713), S(2714), S(2717),
+	S(2719), S(2722), S(2726), S(2730), S(2734), S(2739), S(2744), S(2750),
+	S(2756), S(2762), S(2769), S(2776), S(2783), S(2791), S(2799), S(2807),
+	S(2815), S(2823), S(2831), S(2839), S(2847), S(2855), S(2863), S(2870),
+	S(2877), S(2884), S(2891), S(2897), S(2903), S(2909), S(2914), S(2918),
+	S(2923), S(2926), S(2930), S(2932), S(2935), S(2936), S(2938), S(2939),
+	S(2939), S(2939), S(2939), S(2939), S(2938), S(2937), S(2936), S(2934),
+	S(2933), S(2932), S(2930), S(2929), S(2928), S(2927), S(2926), S(2926),
+	S(2926), S(2926), S(2926), S(2927), S(2929), S(2931), S(2933), S(2936),
+	S(2940), S(2943), S(2948), S(2953), S(2958), S(2964), S(2971), S(2978),
+	S(2985), S(2993), S(3001), S(3009), S(3018), S(3027), S(3035), S(3044),
+	S(3053), S(3062), S(3071), S(3080), S(3089), S(3097), S(3105), S(3113),
+	S(3120), S(3127), S(3134), S(3140), S(3145), S(3150), S(3154), S(3158),
+	S(3161), S(3164), S(3166), S(3167), S(3168), S(3168), S(3168), S(3168),
+	S(3167), S(3165), S(3163), S(3161), S(3159), S(3157), S(3154), S(3152),
+	S(3149), S(3146), S(3144), S(3142), S(3140), S(3139), S(3137), S(3137),
+	S(3136), S(3137), S(3138), S(3139), S(3141), S(3144), S(3147), S(3151),
+	S(3156), S(3161), S(3167), S(3174), S(3181), S(3189), S(3197), S(3206),
+	S(3216), S(3225), S(3235), S(3246), S(3256), S(3267), S(3278), S(3288),
+	S(3299), S(3309), S(3320), S(3329), S(3339), S(3348), S(3357), S(3365),
+	S(3372), S(3379), S(3385), S(3391), S(3395), S(3399), S(3402), S(3404),
+	S(3406), S(3407), S(3407), S(3406), S(3404), S(3402), S(3399), S(3396),
+	S(3392), S(3388), S(3384), S(3379), S(3374), S(3369), S(3364), S(3359),
+	S(3354), S(3350), S(3345), S(3342), S(3339), S(3336), S(3334), S(3333),
+	S(3332), S(3333), S(3334), S(3336), S(3340), S(3344), S(3349), S(3355),
+	S(3362), S(3370), S(3379), S(3389), S(3400), S(3411), S(3423), S(3436),
+	S(3449), S(3463), S(3477), S(3492), S(3506), S(3521), S(3535), S(3549),
+	S(3563), S(3577), S(3590), S(3602), S(3614), S(3625), S(3634), S(3643),
+	S(3651), S(3657), S(3663), S(3667), S(3670), S(3671), S(3671), S(3670),
+	S(3668), S(3664), S(3659), S(3653), S(3646), S(3638), S(3629), S(3620),
+	S(3609), S(3598), S(3587), S(3575), S(3564), S(3552), S(3541), S(3529),
+	S(3519), S(3509), S(3500), S(3492), S(3485), S(3480), S(3476), S(3473),
+	S(3472), S(3473), S(3476), S(3481), S(3487), S(3496), S(3507), S(3519),
+	S(3534), S(3550), S(3569), S(3589), S(3611), S(3634), S(3659), S(3685),
+	S(3713), S(3741), S(3769), S(3798), S(3828), S(3857), S(3886), S(3914),
+	S(3941), S(3967), S(3991), S(4014), S(4034), S(4052), S(4067), S(4079),
+	S(4088), S(4093), S(4095), S(4092), S(4086), S(4074), S(4058), S(4038),
+	S(4012), S(3981), S(3946), S(3905), S(3859), S(3807), S(3751), S(3689),
+	S(3622), S(3551), S(3474), S(3394), S(3308), S(3219), S(3125), S(3029),
+	S(2928), S(2825), S(2719), S(2611), S(2500), S(2389), S(2276), S(2162)
+};
+
+static const sample_t SquareBand256[1024] =
+{
+	S(2047), S(532), S(0), S(269), S(480), S(327), S(196), S(302),
+	S(398), S(316), S(241), S(307), S(369), S(313), S(261), S(309),
+	S(355), S(312), S(272), S(310), S(346), S(312), S(279), S(310),
+	S(340), S(312), S(284), S(310), S(336), S(311), S(287), S(310),
+	S(333), S(311), S(290), S(310), S(331), S(311), S(292), S(311),
+	S(329), S(311), S(294), S(311), S(327), S(311), S(295), S(311),
+	S(326), S(311), S(297), S(311), S(325), S(311), S(298), S(311),
+	S(324), S(311), S(298), S(311), S(323), S(311), S(299), S(311),
+	S(322), S(311), S(300), S(311), S(321), S(311), S(300), S(311),
+	S(321), S(311), S(301), S(311), S(320), S(311), S(301), S(311),
+	S(320), S(311), S(302), S(311), S(320), S(311), S(302), S(311),
+	S(319), S(311), S(303), S(311), S(319), S(311), S(303), S(311),
+	S(319), S(311), S(303), S(311), S(318), S(311), S(303), S(311),
+	S(318), S(311), S(304), S(311), S(318), S(311), S(304), S(311),
+	S(318), S(311), S(304), S(311), S(317), S(311), S(304), S(311),
+	S(317), S(311), S(304), S(311), S(317), S(311), S(305), S(311),
+	S(317), S(311), S(305), S(311), S(317), S(311), S(305), S(311),
+	S(317), S(311), S(305), S(311), S(317), S(311), S(305), S(311),
+	S(316), S(311), S(305), S(311), S(316), S(311), S(305), S(311),
+	S(316), S(311), S(306), S(311), S(316), S(311), S(306), S(311),
+	S(316), S(311), S(306), S(311), S(316), S(311), S(306), S(311),
+	S(316), S(311), S(306), S(311), S(316), S(311), S(306), S(311),
+	S(316), S(311), S(306), S(311), S(316), S(311), S(306), S(311),
+	S(316), S(311), S(306), S(311), S(316), S(311), S(306), S(311),
+	S(316), S(311), S(306), S(311), S(315), S(311), S(306), S(311),
+	S(315), S(311), S(306), S(311), S(315), S(311), S(306), S(311),
+	S(315), S(311), S(306), S(311), S(315), S(311), S(306), S(311),
+	S(315), S(311), S(306), S(311), S(315), S(311), S(306), S(311),
+	S(315), S(311), S(306), S(311), S(315), S(311), S(306), S(311),
+	S(315), S(311), S(306), S(311), S(315), S(311), S(306), S(311),
+	S(315), S(311), S(307), S(311), S(315), S(311), S(307), S(311),
+	S(315), S(311), S(307), S(311), S(315), S(311), S(307), S(311),
+	S(315), S(311), S(307), S(311), S(315), S(311), S(307), S(311),
+	S(315), S(311), S(307), S(311), S(315), S(311), S(307), S(311),
+	S(315), S(311), S(306), S(311), S(315), S(311), S(306), S(311),
+	S(315), S(311), S(306), S(311), S(315), S(311), S(306), S(311),
+	S(315), S(311), S(306), S(311), S(315), S(311), S(306), S(311),
+	S(315), S(311), S(306), S(311), S(315), S(311), S(306), S(311),
+	S(315), S(311), S(306), S(311), S(315), S(311), S(306), S(311),
+	S(315), S(311), S(306), S(311), S(315), S(311), S(306), S(311),
+	S(316), S(311), S(306), S(311), S(316), S(311), S(306), S(311),
+	S(316), S(311), S(306), S(311), S(316), S(311), S(306), S(311),
+	S(316), S(311), S(306), S(311), S(316), S(311), S(306), S(311),
+	S(316), S(311), S(306), S(311), S(316), S(311), S(306), S(311),
+	S(316), S(311), S(306), S(311), S(316), S(311), S(306), S(311),
+	S(316), S(311), S(305), S(311), S(316), S(311), S(305), S(311),
+	S(316), S(311), S(305), S(311), S(317), S(311), S(305), S(311),
+	S(317), S(311), S(305), S(311), S(317), S(311), S(305), S(311),
+	S(317), S(311), S(305), S(311), S(317), S(311), S(304), S(311),
+	S(317), S(311), S(304), S(311), S(317), S(311), S(304), S(311),
+	S(318), S(311), S(304), S(311), S(318), S(311), S(304), S(311),
+	S(318), S(311), S(303), S(311), S(318), S(311), S(303), S(311),
+	S(319), S(311), S(303), S(311), S(319), S(311), S(303), S(311),
+	S(319), S(311), S(302), S(311), S(320), S(311), S(302), S(311),
+	S(320), S(311), S(301), S(311), S(320), S(311), S(301), S(311),
+	S(321), S(311), S(300), S(311), S(321), S(311), S(300), S(311),
+	S(322), S(311), S(299), S(311), S(323), S(311), S(298), S(311),
+	S(324), S(311), S(298), S(311), S(325), S(311), S(297), S(311),
+	S(326), S(311), S(295), S(311), S(327), S(311), S(294), S(311),
+	S(329), S(311), S(292), S(311), S(331), S(310), S(290), S(311),
+	S(333), S(310), S(287), S(311), S(336), S(310), S(284), S(312),
+	S(340), S(310), S(279), S(312), S(346), S(310), S(272), S(312),
+	S(355), S(309), S(261), S(313), S(369), S(307), S(241), S(316),
+	S(398), S(302), S(196), S(327), S(480), S(269), S(0), S(532),
+	S(2047), S(3563), S(4095), S(3826), S(3615), S(3768), S(3899), S(3793),
+	S(3697), S(3779), S(3854), S(3788), S(3726), S(3782), S(3834), S(3786),
+	S(3740), S(3783), S(3823), S(3785), S(3749), S(3783), S(3816), S(3785),
+	S(3755), S(3783), S(3811), S(3785), S(3759), S(3784), S(3808), S(3785),
+	S(3762), S(3784), S(3805), S(3785), S(3764), S(3784), S(3803), S(3784),
+	S(3766), S(3784), S(3801), S(3784), S(3768), S(3784), S(3800), S(3784),
+	S(3769), S(3784), S(3798), S(3784), S(3770), S(3784), S(3797), S(3784),
+	S(3771), S(3784), S(3797), S(3784), S(3772), S(3784), S(3796), S(3784),
+	S(3773), S(3784), S(3795), S(3784), S(3774), S(3784), S(3795), S(3784),
+	S(3774), S(3784), S(3794), S(3784), S(3775), S(3784), S(3794), S(3784),
+	S(3775), S(3784), S(3793), S(3784), S(3775), S(3784), S(3793), S(3784),
+	S(3776), S(3784), S(3792), S(3784), S(3776), S(3784), S(3792), S(3784),
+	S(3776), S(3784), S(3792), S(3784), S(3777), S(3784), S(3792), S(3784),
+	S(3777), S(3784), S(3791), S(3784), S(3777), S(3784), S(3791), S(3784),
+	S(3777), S(3784), S(3791), S(3784), S(3778), S(3784), S(3791), S(3784),
+	S(3778), S(3784), S(3791), S(3784), S(3778), S(3784), S(3790), S(3784),
+	S(3778), S(3784), S(3790), S(3784), S(3778), S(3784), S(3790), S(3784),
+	S(3778), S(3784), S(3790), S(3784), S(3778), S(3784), S(3790), S(3784),
+	S(3779), S(3784), S(3790), S(3784), S(3779), S(3784), S(3790), S(3784),
+	S(3779), S(3784), S(3789), S(3784), S(3779), S(3784), S(3789), S(3784),
+	S(3779), S(3784), S(3789), S(3784), S(3779), S(3784), S(3789), S(3784),
+	S(3779), S(3784), S(3789), S(3784), S(3779), S(3784), S(3789), S(3784),
+	S(3779), S(3784), S(3789), S(3784), S(3779), S(3784), S(3789), S(3784),
+	S(3779), S(3784), S(3789), S(3784), S(3779), S(3784), S(3789), S(3784),
+	S(3779), S(3784), S(3789), S(3784), S(3780), S(3784), S(3789), S(3784),
+	S(3780), S(3784), S(3789), S(3784), S(3780), S(3784), S(3789), S(3784),
+	S(3780), S(3784), S(3789), S(3784), S(3780), S(3784), S(3789), S(3784),
+	S(3780), S(3784), S(3789), S(3784), S(3780), S(3784), S(3789), S(3784),
+	S(3780), S(3784), S(3789), S(3784), S(3780), S(3784), S(3789), S(3784),
+	S(3780), S(3784), S(3789), S(3784), S(3780), S(3784), S(3789), S(3784),
+	S(3780), S(3784), S(3788), S(3784), S(3780), S(3784), S(3788), S(3784),
+	S(3780), S(3784), S(3788), S(3784), S(3780), S(3784), S(3788), S(3784),
+	S(3780), S(3784), S(3788), S(3784), S(3780), S(3784), S(3788), S(3784),
+	S(3780), S(3784), S(3788), S(3784), S(3780), S(3784), S(3788), S(3784),
+	S(3780), S(3784), S(3789), S(3784), S(3780), S(3784), S(3789), S(3784),
+	S(3780), S(3784), S(3789), S(3784), S(3780), S(3784), S(3789), S(3784),
+	S(3780), S(3784), S(3789), S(3784), S(3780), S(3784), S(3789), S(3784),
+	S(3780), S(3784), S(3789), S(3784), S(3780), S(3784), S(3789), S(3784),
+	S(3780), S(3784), S(3789), S(3784), S(3780), S(3784), S(3789), S(3784),
+	S(3780), S(3784), S(3789), S(3784), S(3780), S(3784), S(3789), S(3784),
+	S(3779), S(3784), S(3789), S(3784), S(3779), S(3784), S(3789), S(3784),
+	S(3779), S(3784), S(3789), S(3784), S(3779), S(3784), S(3789), S(3784),
+	S(3779), S(3784), S(3789), S(3784), S(3779), S(3784), S(3789), S(3784),
+	S(3779), S(3784), S(3789), S(3784), S(3779), S(3784), S(3789), S(3784),
+	S(3779), S(3784), S(3789), S(3784), S(3779), S(3784), S(3789), S(3784),
+	S(3779), S(3784), S(3790), S(3784), S(3779), S(3784), S(3790), S(3784),
+	S(3779), S(3784), S(3790), S(3784), S(3778), S(3784), S(3790), S(3784),
+	S(3778), S(3784), S(3790), S(3784), S(3778), S(3784), S(3790), S(3784),
+	S(3778), S(3784), S(3790), S(3784), S(3778), S(3784), S(3791), S(3784),
+	S(3778), S(3784), S(3791), S(3784), S(3778), S(3784), S(3791), S(3784),
+	S(3777), S(3784), S(3791), S(3784), S(3777), S(3784), S(3791), S(3784),
+	S(3777), S(3784), S(3792), S(3784), S(3777), S(3784), S(3792), S(3784),
+	S(3776), S(3784), S(3792), S(3784), S(3776), S(3784), S(3792), S(3784),
+	S(3776), S(3784), S(3793), S(3784), S(3775), S(3784), S(3793), S(3784),
+	S(3775), S(3784), S(3794), S(3784), S(3775), S(3784), S(3794), S(3784),
+	S(3774), S(3784), S(3795), S(3784), S(3774), S(3784), S(3795), S(3784),
+	S(3773), S(3784), S(3796), S(3784), S(3772), S(3784), S(3797), S(3784),
+	S(3771), S(3784), S(3797), S(3784), S(3770), S(3784), S(3798), S(3784),
+	S(3769), S(3784), S(3800), S(3784), S(3768), S(3784), S(3801), S(3784),
+	S(3766), S(3784), S(3803), S(3784), S(3764), S(3785), S(3805), S(3784),
+	S(3762), S(3785), S(3808), S(3784), S(3759), S(3785), S(3811), S(3783),
+	S(3755), S(3785), S(3816), S(3783), S(3749), S(3785), S(3823), S(3783),
+	S(3740), S(3786), S(3834), S(3782), S(3726), S(3788), S(3854), S(3779),
+	S(3697), S(3793), S(3899), S(3768), S(3615), S(3826), S(4095), S(3563)
+};
+
+static const sample_t SquareBand128[1024] =
+{
+	S(2048), S(1208), S(532), S(124), S(0), S(89), S(269), S(423),
+	S(480), S(432), S(327), S(232), S(196), S(228), S(302), S(371),
+	S(398), S(373), S(316), S(262), S(241), S(261), S(307), S(352),
+	S(369), S(353), S(313), S(276), S(261), S(275), S(309), S(342),
+	S(355), S(342), S(312), S(283), S(272), S(283), S(310), S(336),
+	S(346), S(336), S(312), S(288), S(279), S(288), S(310), S(332),
+	S(341), S(332), S(312), S(292), S(283), S(291), S(310), S(329),
+	S(336), S(329), S(311), S(294), S(287), S(294), S(310), S(327),
+	S(333), S(327), S(311), S(296), S(290), S(296), S(311), S(325),
+	S(331), S(325), S(311), S(297), S(292), S(297), S(311), S(324),
+	S(329), S(324), S(311), S(299), S(293), S(298), S(311), S(323),
+	S(328), S(323), S(311), S(299), S(295), S(299), S(311), S(322),
+	S(326), S(322), S(311), S(300), S(296), S(300), S(311), S(321),
+	S(325), S(321), S(311), S(301), S(297), S(301), S(311), S(320),
+	S(324), S(321), S(311), S(302), S(298), S(301), S(311), S(320),
+	S(324), S(320), S(311), S(302), S(298), S(302), S(311), S(319),
+	S(323), S(320), S(311), S(302), S(299), S(302), S(311), S(319),
+	S(323), S(319), S(311), S(303), S(299), S(303), S(311), S(319),
+	S(322), S(319), S(311), S(303), S(300), S(303), S(311), S(318),
+	S(322), S(318), S(311), S(303), S(300), S(303), S(311), S(318),
+	S(321), S(318), S(311), S(304), S(301), S(304), S(311), S(318),
+	S(321), S(318), S(311), S(304), S(301), S(304), S(311), S(318),
+	S(321), S(318), S(311), S(304), S(301), S(304), S(311), S(318),
+	S(320), S(318), S(311), S(304), S(301), S(304), S(311), S(317),
+	S(320), S(317), S(311), S(304), S(302), S(304), S(311), S(317),
+	S(320), S(317), S(311), S(304), S(302), S(304), S(311), S(317),
+	S(320), S(317), S(311), S(305), S(302), S(305), S(311), S(317),
+	S(320), S(317), S(311), S(305), S(302), S(305), S(311), S(317),
+	S(320), S(317), S(311), S(305), S(302), S(305), S(311), S(317),
+	S(320), S(317), S(311), S(305), S(302), S(305), S(311), S(317),
+	S(320), S(317), S(311), S(305), S(302), S(305), S(311), S(317),
+	S(320), S(317), S(311), S(305), S(302), S(305), S(311), S(317),
+	S(319), S(317), S(311), S(305), S(302), S(305), S(311), S(317),
+	S(320), S(317), S(311), S(305), S(302), S(305), S(311), S(317),
+	S(320), S(317), S(311), S(305), S(302), S(305), S(311), S(317),
+	S(320), S(317), S(311), S(305), S(302), S(305), S(311), S(317),
+	S(320), S(317), S(311), S(305), S(302), S(305), S(311), S(317),
+	S(320), S(317), S(311), S(305), S(302), S(305), S(311), S(317),
+	S(320), S(317), S(311), S(304), S(302), S(304), S(311), S(317),
+	S(320), S(317), S(311), S(304), S(302), S(304), S(311), S(317),
+	S(320), S(317), S(311), S(304), S(301), S(304), S(311), S(318),
+	S(320), S(318), S(311), S(304), S(301), S(304), S(311), S(318),
+	S(321), S(318), S(311), S(304), S(301), S(304), S(311), S(318),
+	S(321), S(318), S(311), S(304), S(301), S(304), S(311), S(318),
+	S(321), S(318), S(311), S(303), S(300), S(303), S(311), S(318),
+	S(322), S(318), S(311), S(303), S(300), S(303), S(311), S(319),
+	S(322), S(319), S(311), S(303), S(299), S(303), S(311), S(319),
+	S(323), S(319), S(311), S(302), S(299), S(302), S(311), S(320),
+	S(323), S(319), S(311), S(302), S(298), S(302), S(311), S(320),
+	S(324), S(320), S(311), S(301), S(298), S(302), S(311), S(321),
+	S(324), S(320), S(311), S(301), S(297), S(301), S(311), S(321),
+	S(325), S(321), S(311), S(300), S(296), S(300), S(311), S(322),
+	S(326), S(322), S(311), S(299), S(295), S(299), S(311), S(323),
+	S(328), S(323), S(311), S(298), S(293), S(299), S(311), S(324),
+	S(329), S(324), S(311), S(297), S(292), S(297), S(311), S(325),
+	S(331), S(325), S(311), S(296), S(290), S(296), S(311), S(327),
+	S(333), S(327), S(310), S(294), S(287), S(294), S(311), S(329),
+	S(336), S(329), S(310), S(291), S(283), S(292), S(312), S(332),
+	S(341), S(332), S(310), S(288), S(279), S(288), S(312), S(336),
+	S(346), S(336), S(310), S(283), S(272), S(283), S(312), S(342),
+	S(355), S(342), S(309), S(275), S(261), S(276), S(313), S(353),
+	S(369), S(352), S(307), S(261), S(241), S(262), S(316), S(373),
+	S(398), S(371), S(302), S(228), S(196), S(232), S(327), S(432),
+	S(480), S(423), S(269), S(89), S(0), S(124), S(532), S(1208),
+	S(2047), S(2887), S(3563), S(3971), S(4095), S(4006), S(3826), S(3672),
+	S(3615), S(3663), S(3768), S(3863), S(3899), S(3867), S(3793), S(3724),
+	S(3697), S(3722), S(3779), S(3833), S(3854), S(3834), S(3788), S(3743),
+	S(3726), S(3742), S(3782), S(3819), S(3834), S(3820), S(3786), S(3753),
+	S(3740), S(3753), S(3783), S(3812), S(3823), S(3812), S(3785), S(3759),
+	S(3749), S(3759), S(3783), S(3807), S(3816), S(3807), S(3785), S(3763),
+	S(3754), S(3763), S(3783), S(3803), S(3812), S(3804), S(3785), S(3766),
+	S(3759), S(3766), S(3784), S(3801), S(3808), S(3801), S(3785), S(3768),
+	S(3762), S(3768), S(3784), S(3799), S(3805), S(3799), S(3784), S(3770),
+	S(3764), S(3770), S(3784), S(3798), S(3803), S(3798), S(3784), S(3771),
+	S(3766), S(3771), S(3784), S(3796), S(3802), S(3797), S(3784), S(3772),
+	S(3767), S(3772), S(3784), S(3796), S(3800), S(3796), S(3784), S(3773),
+	S(3769), S(3773), S(3784), S(3795), S(3799), S(3795), S(3784), S(3774),
+	S(3770), S(3774), S(3784), S(3794), S(3798), S(3794), S(3784), S(3775),
+	S(3771), S(3774), S(3784), S(3793), S(3797), S(3794), S(3784), S(3775),
+	S(3771), S(3775), S(3784), S(3793), S(3797), S(3793), S(3784), S(3776),
+	S(3772), S(3775), S(3784), S(3793), S(3796), S(3793), S(3784), S(3776),
+	S(3772), S(3776), S(3784), S(3792), S(3796), S(3792), S(3784), S(3776),
+	S(3773), S(3776), S(3784), S(3792), S(3795), S(3792), S(3784), S(3777),
+	S(3773), S(3777), S(3784), S(3792), S(3795), S(3792), S(3784), S(3777),
+	S(3774), S(3777), S(3784), S(3791), S(3794), S(3791), S(3784), S(3777),
+	S(3774), S(3777), S(3784), S(3791), S(3794), S(3791), S(3784), S(3777),
+	S(3774), S(3777), S(3784), S(3791), S(3794), S(3791), S(3784), S(3777),
+	S(3775), S(3777), S(3784), S(3791), S(3794), S(3791), S(3784), S(3778),
+	S(3775), S(3778), S(3784), S(3791), S(3793), S(3791), S(3784), S(3778),
+	S(3775), S(3778), S(3784), S(3791), S(3793), S(3791), S(3784), S(3778),
+	S(3775), S(3778), S(3784), S(3790), S(3793), S(3790), S(3784), S(3778),
+	S(3775), S(3778), S(3784), S(3790), S(3793), S(3790), S(3784), S(3778),
+	S(3775), S(3778), S(3784), S(3790), S(3793), S(3790), S(3784), S(3778),
+	S(3775), S(3778), S(3784), S(3790), S(3793), S(3790), S(3784), S(3778),
+	S(3775), S(3778), S(3784), S(3790), S(3793), S(3790), S(3784), S(3778),
+	S(3775), S(3778), S(3784), S(3790), S(3793), S(3790), S(3784), S(3778),
+	S(3776), S(3778), S(3784), S(3790), S(3793), S(3790), S(3784), S(3778),
+	S(3775), S(3778), S(3784), S(3790), S(3793), S(3790), S(3784), S(3778),
+	S(3775), S(3778), S(3784), S(3790), S(3793), S(3790), S(3784), S(3778),
+	S(3775), S(3778), S(3784), S(3790), S(3793), S(3790), S(3784), S(3778),
+	S(3775), S(3778), S(3784), S(3790), S(3793), S(3790), S(3784), S(3778),
+	S(3775), S(3778), S(3784), S(3790), S(3793), S(3790), S(3784), S(3778),
+	S(3775), S(3778), S(3784), S(3791), S(3793), S(3791), S(3784), S(3778),
+	S(3775), S(3778), S(3784), S(3791), S(3793), S(3791), S(3784), S(3778),
+	S(3775), S(3778), S(3784), S(3791), S(3794), S(3791), S(3784), S(3777),
+	S(3775), S(3777), S(3784), S(3791), S(3794), S(3791), S(3784), S(3777),
+	S(3774), S(3777), S(3784), S(3791), S(3794), S(3791), S(3784), S(3777),
+	S(3774), S(3777), S(3784), S(3791), S(3794), S(3791), S(3784), S(3777),
+	S(3774), S(3777), S(3784), S(3792), S(3795), S(3792), S(3784), S(3777),
+	S(3773), S(3777), S(3784), S(3792), S(3795), S(3792), S(3784), S(3776),
+	S(3773), S(3776), S(3784), S(3792), S(3796), S(3792), S(3784), S(3776),
+	S(3772), S(3776), S(3784), S(3793), S(3796), S(3793), S(3784), S(3775),
+	S(3772), S(3776), S(3784), S(3793), S(3797), S(3793), S(3784), S(3775),
+	S(3771), S(3775), S(3784), S(3794), S(3797), S(3793), S(3784), S(3774),
+	S(3771), S(3775), S(3784), S(3794), S(3798), S(3794), S(3784), S(3774),
+	S(3770), S(3774), S(3784), S(3795), S(3799), S(3795), S(3784), S(3773),
+	S(3769), S(3773), S(3784), S(3796), S(3800), S(3796), S(3784), S(3772),
+	S(3767), S(3772), S(3784), S(3797), S(3802), S(3796), S(3784), S(3771),
+	S(3766), S(3771), S(3784), S(3798), S(3803), S(3798), S(3784), S(3770),
+	S(3764), S(3770), S(3784), S(3799), S(3805), S(3799), S(3784), S(3768),
+	S(3762), S(3768), S(3785), S(3801), S(3808), S(3801), S(3784), S(3766),
+	S(3759), S(3766), S(3785), S(3804), S(3812), S(3803), S(3783), S(3763),
+	S(3754), S(3763), S(3785), S(3807), S(3816), S(3807), S(3783), S(3759),
+	S(3749), S(3759), S(3785), S(3812), S(3823), S(3812), S(3783), S(3753),
+	S(3740), S(3753), S(3786), S(3820), S(3834), S(3819), S(3782), S(3742),
+	S(3726), S(3743), S(3788), S(3834), S(3854), S(3833), S(3779), S(3722),
+	S(3697), S(3724), S(3793), S(3867), S(3899), S(3863), S(3768), S(3663),
+	S(3615), S(3672), S(3826), S(4006), S(4095), S(3971), S(3563), S(2887)
+};
+
+static const sample_t SquareBand64[1024] =
+{
+	S(2048), S(1617), S(1208), S(841), S(532), S(291), S(124), S(29),
+	S(0), S(25), S(89), S(176), S(269), S(356), S(424), S(466),
+	S(480), S(467), S(432), S(383), S(327), S(275), S(232), S(205),
+	S(196), S(204), S(228), S(263), S(302), S(340), S(371), S(392),
+	S(398), S(392), S(374), S(347), S(316), S(287), S(262), S(246),
+	S(240), S(246), S(261), S(282), S(307), S(332), S(352), S(366),
+	S(370), S(366), S(353), S(335), S(314), S(293), S(275), S(264),
+	S(260), S(264), S(275), S(291), S(309), S(327), S(342), S(352),
+	S(356), S(353), S(343), S(329), S(312), S(296), S(283), S(274),
+	S(271), S(274), S(282), S(295), S(310), S(324), S(337), S(345),
+	S(348), S(345), S(337), S(325), S(312), S(299), S(287), S(280),
+	S(277), S(280), S(287), S(298), S(310), S(322), S(333), S(340),
+	S(342), S(340), S(333), S(323), S(312), S(300), S(291), S(284),
+	S(282), S(284), S(290), S(300), S(310), S(321), S(330), S(336),
+	S(338), S(336), S(330), S(322), S(311), S(301), S(293), S(287),
+	S(285), S(287), S(293), S(301), S(311), S(320), S(328), S(333),
+	S(335), S(334), S(328), S(320), S(311), S(302), S(295), S(289),
+	S(288), S(289), S(294), S(302), S(311), S(319), S(327), S(332),
+	S(333), S(332), S(327), S(320), S(311), S(303), S(296), S(291),
+	S(289), S(291), S(296), S(303), S(311), S(319), S(326), S(330),
+	S(332), S(330), S(326), S(319), S(311), S(303), S(297), S(292),
+	S(291), S(292), S(297), S(303), S(311), S(318), S(325), S(329),
+	S(331), S(329), S(325), S(319), S(311), S(304), S(297), S(293),
+	S(292), S(293), S(297), S(304), S(311), S(318), S(324), S(328),
+	S(330), S(328), S(324), S(318), S(311), S(304), S(298), S(294),
+	S(293), S(294), S(298), S(304), S(311), S(318), S(324), S(328),
+	S(329), S(328), S(324), S(318), S(311), S(304), S(298), S(295),
+	S(293), S(295), S(298), S(304), S(311), S(318), S(323), S(327),
+	S(329), S(327), S(323), S(318), S(311), S(304), S(299), S(295),
+	S(293), S(295), S(299), S(304), S(311), S(318), S(323), S(327),
+	S(328), S(327), S(323), S(318), S(311), S(304), S(299), S(295),
+	S(294), S(295), S(299), S(304), S(311), S(318), S(323), S(327),
+	S(328), S(327), S(323), S(318), S(311), S(304), S(299), S(295),
+	S(294), S(295), S(299), S(304), S(311), S(318), S(323), S(327),
+	S(328), S(327), S(323), S(318), S(311), S(304), S(299), S(295),
+	S(293), S(295), S(299), S(304), S(311), S(318), S(323), S(327),
+	S(329), S(327), S(323), S(318), S(311), S(304), S(298), S(295),
+	S(293), S(295), S(298), S(304), S(311), S(318), S(324), S(328),
+	S(329), S(328), S(324), S(318), S(311), S(304), S(298), S(294),
+	S(293), S(294), S(298), S(304), S(311), S(318), S(324), S(328),
+	S(330), S(328), S(324), S(318), S(311), S(304), S(297), S(293),
+	S(292), S(293), S(297), S(304), S(311), S(319), S(325), S(329),
+	S(331), S(329), S(325), S(318), S(311), S(303), S(297), S(292),
+	S(291), S(292), S(297), S(303), S(311), S(319), S(326), S(330),
+	S(332), S(330), S(326), S(319), S(311), S(303), S(296), S(291),
+	S(289), S(291), S(296), S(303), S(311), S(320), S(327), S(332),
+	S(333), S(332), S(327), S(319), S(311), S(302), S(294), S(289),
+	S(288), S(289), S(295), S(302), S(311), S(320), S(328), S(334),
+	S(335), S(333), S(328), S(320), S(311), S(301), S(293), S(287),
+	S(285), S(287), S(293), S(301), S(311), S(322), S(330), S(336),
+	S(338), S(336), S(330), S(321), S(310), S(300), S(290), S(284),
+	S(282), S(284), S(291), S(300), S(312), S(323), S(333), S(340),
+	S(342), S(340), S(333), S(322), S(310), S(298), S(287), S(280),
+	S(277), S(280), S(287), S(299), S(312), S(325), S(337), S(345),
+	S(348), S(345), S(337), S(324), S(310), S(295), S(282), S(274),
+	S(271), S(274), S(283), S(296), S(312), S(329), S(343), S(353),
+	S(356), S(352), S(342), S(327), S(309), S(291), S(275), S(264),
+	S(260), S(264), S(275), S(293), S(314), S(335), S(353), S(366),
+	S(370), S(366), S(352), S(332), S(307), S(282), S(261), S(246),
+	S(240), S(246), S(262), S(287), S(316), S(347), S(374), S(392),
+	S(398), S(392), S(371), S(340), S(302), S(263), S(228), S(204),
+	S(196), S(205), S(232), S(275), S(327), S(383), S(432), S(467),
+	S(480), S(466), S(424), S(356), S(269), S(176), S(89), S(25),
+	S(0), S(29), S(124), S(291), S(532), S(841), S(1208), S(1617),
+	S(2047), S(2478), S(2887), S(3254), S(3563), S(3804), S(3971), S(4066),
+	S(4095), S(4070), S(4006), S(3919), S(3826), S(3739), S(3671), S(3629),
+	S(3615), S(3628), S(3663), S(3712), S(3768), S(3820), S(3863), S(3890),
+	S(3899), S(3891), S(3867), S(3832), S(3793), S(3755), S(3724), S(3703),
+	S(3697), S(3703), S(3721), S(3748), S(3779), S(3808), S(3833), S(3849),
+	S(3855), S(3849), S(3834), S(3813), S(3788), S(3763), S(3743), S(3729),
+	S(3725), S(3729), S(3742), S(3760), S(3781), S(3802), S(3820), S(3831),
+	S(3835), S(3831), S(3820), S(3804), S(3786), S(3768), S(3753), S(3743),
+	S(3739), S(3742), S(3752), S(3766), S(3783), S(3799), S(3812), S(3821),
+	S(3824), S(3821), S(3813), S(3800), S(3785), S(3771), S(3758), S(3750),
+	S(3747), S(3750), S(3758), S(3770), S(3783), S(3796), S(3808), S(3815),
+	S(3818), S(3815), S(3808), S(3797), S(3785), S(3773), S(3762), S(3755),
+	S(3753), S(3755), S(3762), S(3772), S(3783), S(3795), S(3804), S(3811),
+	S(3813), S(3811), S(3805), S(3795), S(3785), S(3774), S(3765), S(3759),
+	S(3757), S(3759), S(3765), S(3773), S(3784), S(3794), S(3802), S(3808),
+	S(3810), S(3808), S(3802), S(3794), S(3784), S(3775), S(3767), S(3762),
+	S(3760), S(3761), S(3767), S(3775), S(3784), S(3793), S(3800), S(3806),
+	S(3807), S(3806), S(3801), S(3793), S(3784), S(3776), S(3768), S(3763),
+	S(3762), S(3763), S(3768), S(3775), S(3784), S(3792), S(3799), S(3804),
+	S(3806), S(3804), S(3799), S(3792), S(3784), S(3776), S(3769), S(3765),
+	S(3763), S(3765), S(3769), S(3776), S(3784), S(3792), S(3798), S(3803),
+	S(3804), S(3803), S(3798), S(3792), S(3784), S(3777), S(3770), S(3766),
+	S(3764), S(3766), S(3770), S(3776), S(3784), S(3791), S(3798), S(3802),
+	S(3803), S(3802), S(3798), S(3791), S(3784), S(3777), S(3771), S(3767),
+	S(3765), S(3767), S(3771), S(3777), S(3784), S(3791), S(3797), S(3801),
+	S(3802), S(3801), S(3797), S(3791), S(3784), S(3777), S(3771), S(3767),
+	S(3766), S(3767), S(3771), S(3777), S(3784), S(3791), S(3797), S(3800),
+	S(3802), S(3800), S(3797), S(3791), S(3784), S(3777), S(3772), S(3768),
+	S(3766), S(3768), S(3772), S(3777), S(3784), S(3791), S(3796), S(3800),
+	S(3802), S(3800), S(3796), S(3791), S(3784), S(3777), S(3772), S(3768),
+	S(3767), S(3768), S(3772), S(3777), S(3784), S(3791), S(3796), S(3800),
+	S(3801), S(3800), S(3796), S(3791), S(3784), S(3777), S(3772), S(3768),
+	S(3767), S(3768), S(3772), S(3777), S(3784), S(3791), S(3796), S(3800),
+	S(3801), S(3800), S(3796), S(3791), S(3784), S(3777), S(3772), S(3768),
+	S(3767), S(3768), S(3772), S(3777), S(3784), S(3791), S(3796), S(3800),
+	S(3802), S(3800), S(3796), S(3791), S(3784), S(3777), S(3772), S(3768),
+	S(3766), S(3768), S(3772), S(3777), S(3784), S(3791), S(3797), S(3800),
+	S(3802), S(3800), S(3797), S(3791), S(3784), S(3777), S(3771), S(3767),
+	S(3766), S(3767), S(3771), S(3777), S(3784), S(3791), S(3797), S(3801),
+	S(3802), S(3801), S(3797), S(3791), S(3784), S(3777), S(3771), S(3767),
+	S(3765), S(3767), S(3771), S(3777), S(3784), S(3791), S(3798), S(3802),
+	S(3803), S(3802), S(3798), S(3791), S(3784), S(3776), S(3770), S(3766),
+	S(3764), S(3766), S(3770), S(3777), S(3784), S(3792), S(3798), S(3803),
+	S(3804), S(3803), S(3798), S(3792), S(3784), S(3776), S(3769), S(3765),
+	S(3763), S(3765), S(3769), S(3776), S(3784), S(3792), S(3799), S(3804),
+	S(3806), S(3804), S(3799), S(3792), S(3784), S(3775), S(3768), S(3763),
+	S(3762), S(3763), S(3768), S(3776), S(3784), S(3793), S(3801), S(3806),
+	S(3807), S(3806), S(3800), S(3793), S(3784), S(3775), S(3767), S(3761),
+	S(3760), S(3762), S(3767), S(3775), S(3784), S(3794), S(3802), S(3808),
+	S(3810), S(3808), S(3802), S(3794), S(3784), S(3773), S(3765), S(3759),
+	S(3757), S(3759), S(3765), S(3774), S(3785), S(3795), S(3805), S(3811),
+	S(3813), S(3811), S(3804), S(3795), S(3783), S(3772), S(3762), S(3755),
+	S(3753), S(3755), S(3762), S(3773), S(3785), S(3797), S(3808), S(3815),
+	S(3818), S(3815), S(3808), S(3796), S(3783), S(3770), S(3758), S(3750),
+	S(3747), S(3750), S(3758), S(3771), S(3785), S(3800), S(3813), S(3821),
+	S(3824), S(3821), S(3812), S(3799), S(3783), S(3766), S(3752), S(3742),
+	S(3739), S(3743), S(3753), S(3768), S(3786), S(3804), S(3820), S(3831),
+	S(3835), S(3831), S(3820), S(3802), S(3781), S(3760), S(3742), S(3729),
+	S(3725), S(3729), S(3743), S(3763), S(3788), S(3813), S(3834), S(3849),
+	S(3855), S(3849), S(3833), S(3808), S(3779), S(3748), S(3721), S(3703),
+	S(3697), S(3703), S(3724), S(3755), S(3793), S(3832), S(3867), S(3891),
+	S(3899), S(3890), S(3863), S(3820), S(3768), S(3712), S(3663), S(3628),
+	S(3615), S(3629), S(3671), S(3739), S(3826), S(3919), S(4006), S(4070),
+	S(4095), S(4066), S(3971), S(3804), S(3563), S(3254), S(2887), S(2478)
+};
+
+static const sample_t SquareBand32[1024] =
+{
+	S(2048), S(1831), S(1617), S(1409), S(1209), S(1019), S(842), S(679),
+	S(532), S(403), S(291), S(199), S(124), S(68), S(29), S(7),
+	S(0), S(7), S(25), S(53), S(89), S(131), S(176), S(223),
+	S(270), S(315), S(357), S(393), S(425), S(449), S(467), S(478),
+	S(481), S(478), S(468), S(453), S(433), S(410), S(383), S(356),
+	S(328), S(300), S(275), S(251), S(232), S(216), S(204), S(197),
+	S(195), S(197), S(204), S(214), S(228), S(244), S(263), S(283),
+	S(303), S(323), S(341), S(358), S(373), S(385), S(394), S(399),
+	S(401), S(399), S(394), S(386), S(375), S(362), S(348), S(332),
+	S(316), S(301), S(286), S(272), S(261), S(251), S(244), S(240),
+	S(239), S(240), S(244), S(251), S(259), S(270), S(282), S(295),
+	S(308), S(321), S(333), S(345), S(354), S(362), S(368), S(372),
+	S(373), S(372), S(368), S(363), S(355), S(346), S(336), S(325),
+	S(314), S(302), S(292), S(282), S(273), S(266), S(261), S(258),
+	S(257), S(258), S(261), S(266), S(273), S(281), S(290), S(299),
+	S(310), S(320), S(329), S(338), S(345), S(352), S(356), S(359),
+	S(360), S(359), S(356), S(352), S(346), S(339), S(331), S(322),
+	S(313), S(304), S(295), S(287), S(280), S(274), S(270), S(268),
+	S(267), S(268), S(270), S(274), S(280), S(286), S(294), S(302),
+	S(310), S(319), S(327), S(334), S(340), S(346), S(350), S(352),
+	S(353), S(352), S(350), S(346), S(341), S(335), S(328), S(320),
+	S(312), S(304), S(297), S(290), S(284), S(279), S(275), S(273),
+	S(272), S(273), S(275), S(279), S(284), S(289), S(296), S(303),
+	S(311), S(318), S(325), S(332), S(338), S(342), S(346), S(348),
+	S(349), S(348), S(346), S(342), S(338), S(332), S(326), S(319),
+	S(312), S(305), S(298), S(291), S(286), S(281), S(278), S(276),
+	S(275), S(276), S(278), S(281), S(286), S(291), S(297), S(304),
+	S(311), S(318), S(325), S(331), S(336), S(341), S(344), S(346),
+	S(346), S(346), S(344), S(341), S(336), S(331), S(325), S(318),
+	S(311), S(305), S(298), S(292), S(287), S(282), S(279), S(277),
+	S(277), S(277), S(279), S(282), S(287), S(292), S(298), S(305),
+	S(311), S(318), S(324), S(330), S(336), S(340), S(343), S(345),
+	S(346), S(345), S(343), S(340), S(336), S(330), S(324), S(318),
+	S(311), S(305), S(298), S(292), S(287), S(282), S(279), S(277),
+	S(277), S(277), S(279), S(282), S(287), S(292), S(298), S(305),
+	S(311), S(318), S(325), S(331), S(336), S(341), S(344), S(346),
+	S(346), S(346), S(344), S(341), S(336), S(331), S(325), S(318),
+	S(311), S(304), S(297), S(291), S(286), S(281), S(278), S(276),
+	S(275), S(276), S(278), S(281), S(286), S(291), S(298), S(305),
+	S(312), S(319), S(326), S(332), S(338), S(342), S(346), S(348),
+	S(349), S(348), S(346), S(342), S(338), S(332), S(325), S(318),
+	S(311), S(303), S(296), S(289), S(284), S(279), S(275), S(273),
+	S(272), S(273), S(275), S(279), S(284), S(290), S(297), S(304),
+	S(312), S(320), S(328), S(335), S(341), S(346), S(350), S(352),
+	S(353), S(352), S(350), S(346), S(340), S(334), S(327), S(319),
+	S(310), S(302), S(294), S(286), S(280), S(274), S(270), S(268),
+	S(267), S(268), S(270), S(274), S(280), S(287), S(295), S(304),
+	S(313), S(322), S(331), S(339), S(346), S(352), S(356), S(359),
+	S(360), S(359), S(356), S(352), S(345), S(338), S(329), S(320),
+	S(310), S(299), S(290), S(281), S(273), S(266), S(261), S(258),
+	S(257), S(258), S(261), S(266), S(273), S(282), S(292), S(302),
+	S(314), S(325), S(336), S(346), S(355), S(363), S(368), S(372),
+	S(373), S(372), S(368), S(362), S(354), S(345), S(333), S(321),
+	S(308), S(295), S(282), S(270), S(259), S(251), S(244), S(240),
+	S(239), S(240), S(244), S(251), S(261), S(272), S(286), S(301),
+	S(316), S(332), S(348), S(362), S(375), S(386), S(394), S(399),
+	S(401), S(399), S(394), S(385), S(373), S(358), S(341), S(323),
+	S(303), S(283), S(263), S(244), S(228), S(214), S(204), S(197),
+	S(195), S(197), S(204), S(216), S(232), S(251), S(275), S(300),
+	S(328), S(356), S(383), S(410), S(433), S(453), S(468), S(478),
+	S(481), S(478), S(467), S(449), S(425), S(393), S(357), S(315),
+	S(270), S(223), S(176), S(131), S(89), S(53), S(25), S(7),
+	S(0), S(7), S(29), S(68), S(124), S(199), S(291), S(403),
+	S(532), S(679), S(842), S(1019), S(1209), S(1409), S(1617), S(1831),
+	S(2047), S(2264), S(2478), S(2686), S(2886), S(3076), S(3253), S(3416),
+	S(3563), S(3692), S(3804), S(3896), S(3971), S(4027), S(4066), S(4088),
+	S(4095), S(4088), S(4070), S(4042), S(4006), S(3964), S(3919), S(3872),
+	S(3825), S(3780), S(3738), S(3702), S(3670), S(3646), S(3628), S(3617),
+	S(3614), S(3617), S(3627), S(3642), S(3662), S(3685), S(3712), S(3739),
+	S(3767), S(3795), S(3820), S(3844), S(3863), S(3879), S(3891), S(3898),
+	S(3900), S(3898), S(3891), S(3881), S(3867), S(3851), S(3832), S(3812),
+	S(3792), S(3772), S(3754), S(3737), S(3722), S(3710), S(3701), S(3696),
+	S(3694), S(3696), S(3701), S(3709), S(3720), S(3733), S(3747), S(3763),
+	S(3779), S(3794), S(3809), S(3823), S(3834), S(3844), S(3851), S(3855),
+	S(3856), S(3855), S(3851), S(3844), S(3836), S(3825), S(3813), S(3800),
+	S(3787), S(3774), S(3762), S(3750), S(3741), S(3733), S(3727), S(3723),
+	S(3722), S(3723), S(3727), S(3732), S(3740), S(3749), S(3759), S(3770),
+	S(3781), S(3793), S(3803), S(3813), S(3822), S(3829), S(3834), S(3837),
+	S(3838), S(3837), S(3834), S(3829), S(3822), S(3814), S(3805), S(3796),
+	S(3785), S(3775), S(3766), S(3757), S(3750), S(3743), S(3739), S(3736),
+	S(3735), S(3736), S(3739), S(3743), S(3749), S(3756), S(3764), S(3773),
+	S(3782), S(3791), S(3800), S(3808), S(3815), S(3821), S(3825), S(3827),
+	S(3828), S(3827), S(3825), S(3821), S(3815), S(3809), S(3801), S(3793),
+	S(3785), S(3776), S(3768), S(3761), S(3755), S(3749), S(3745), S(3743),
+	S(3742), S(3743), S(3745), S(3749), S(3754), S(3760), S(3767), S(3775),
+	S(3783), S(3791), S(3798), S(3805), S(3811), S(3816), S(3820), S(3822),
+	S(3823), S(3822), S(3820), S(3816), S(3811), S(3806), S(3799), S(3792),
+	S(3784), S(3777), S(3770), S(3763), S(3757), S(3753), S(3749), S(3747),
+	S(3746), S(3747), S(3749), S(3753), S(3757), S(3763), S(3769), S(3776),
+	S(3783), S(3790), S(3797), S(3804), S(3809), S(3814), S(3817), S(3819),
+	S(3820), S(3819), S(3817), S(3814), S(3809), S(3804), S(3798), S(3791),
+	S(3784), S(3777), S(3770), S(3764), S(3759), S(3754), S(3751), S(3749),
+	S(3749), S(3749), S(3751), S(3754), S(3759), S(3764), S(3770), S(3777),
+	S(3784), S(3790), S(3797), S(3803), S(3808), S(3813), S(3816), S(3818),
+	S(3818), S(3818), S(3816), S(3813), S(3808), S(3803), S(3797), S(3790),
+	S(3784), S(3777), S(3771), S(3765), S(3759), S(3755), S(3752), S(3750),
+	S(3749), S(3750), S(3752), S(3755), S(3759), S(3765), S(3771), S(3777),
+	S(3784), S(3790), S(3797), S(3803), S(3808), S(3813), S(3816), S(3818),
+	S(3818), S(3818), S(3816), S(3813), S(3808), S(3803), S(3797), S(3790),
+	S(3784), S(3777), S(3770), S(3764), S(3759), S(3754), S(3751), S(3749),
+	S(3749), S(3749), S(3751), S(3754), S(3759), S(3764), S(3770), S(3777),
+	S(3784), S(3791), S(3798), S(3804), S(3809), S(3814), S(3817), S(3819),
+	S(3820), S(3819), S(3817), S(3814), S(3809), S(3804), S(3797), S(3790),
+	S(3783), S(3776), S(3769), S(3763), S(3757), S(3753), S(3749), S(3747),
+	S(3746), S(3747), S(3749), S(3753), S(3757), S(3763), S(3770), S(3777),
+	S(3784), S(3792), S(3799), S(3806), S(3811), S(3816), S(3820), S(3822),
+	S(3823), S(3822), S(3820), S(3816), S(3811), S(3805), S(3798), S(3791),
+	S(3783), S(3775), S(3767), S(3760), S(3754), S(3749), S(3745), S(3743),
+	S(3742), S(3743), S(3745), S(3749), S(3755), S(3761), S(3768), S(3776),
+	S(3785), S(3793), S(3801), S(3809), S(3815), S(3821), S(3825), S(3827),
+	S(3828), S(3827), S(3825), S(3821), S(3815), S(3808), S(3800), S(3791),
+	S(3782), S(3773), S(3764), S(3756), S(3749), S(3743), S(3739), S(3736),
+	S(3735), S(3736), S(3739), S(3743), S(3750), S(3757), S(3766), S(3775),
+	S(3785), S(3796), S(3805), S(3814), S(3822), S(3829), S(3834), S(3837),
+	S(3838), S(3837), S(3834), S(3829), S(3822), S(3813), S(3803), S(3793),
+	S(3781), S(3770), S(3759), S(3749), S(3740), S(3732), S(3727), S(3723),
+	S(3722), S(3723), S(3727), S(3733), S(3741), S(3750), S(3762), S(3774),
+	S(3787), S(3800), S(3813), S(3825), S(3836), S(3844), S(3851), S(3855),
+	S(3856), S(3855), S(3851), S(3844), S(3834), S(3823), S(3809), S(3794),
+	S(3779), S(3763), S(3747), S(3733), S(3720), S(3709), S(3701), S(3696),
+	S(3694), S(3696), S(3701), S(3710), S(3722), S(3737), S(3754), S(3772),
+	S(3792), S(3812), S(3832), S(3851), S(3867), S(3881), S(3891), S(3898),
+	S(3900), S(3898), S(3891), S(3879), S(3863), S(3844), S(3820), S(3795),
+	S(3767), S(3739), S(3712), S(3685), S(3662), S(3642), S(3627), S(3617),
+	S(3614), S(3617), S(3628), S(3646), S(3670), S(3702), S(3738), S(3780),
+	S(3825), S(3872), S(3919), S(3964), S(4006), S(4042), S(4070), S(4088),
+	S(4095), S(4088), S(4066), S(4027), S(3971), S(3896), S(3804), S(3692),
+	S(3563), S(3416), S(3253), S(3076), S(2886), S(2686), S(2478), S(2264)
+};
+
+static const sample_t SquareBand16[1024] =
+{
+	S(2048), S(1939), S(1831), S(1724), S(1617), S(1513), S(1409), S(1308),
+	S(1209), S(1113), S(1019), S(929), S(842), S(759), S(680), S(604),
+	S(533), S(466), S(403), S(345), S(292), S(243), S(199), S(159),
+	S(124), S(94), S(68), S(47), S(29), S(16), S(7), S(2),
+	S(0), S(2), S(7), S(14), S(25), S(38), S(53), S(70),
+	S(89), S(110), S(131), S(154), S(177), S(201), S(225), S(248),
+	S(272), S(295), S(317), S(339), S(360), S(379), S(397), S(413),
+	S(429), S(442), S(454), S(464), S(472), S(478), S(482), S(485),
+	S(486), S(485), S(483), S(478), S(473), S(466), S(457), S(448),
+	S(437), S(425), S(413), S(400), S(386), S(372), S(357), S(343),
+	S(328), S(314), S(300), S(287), S(274), S(261), S(250), S(239),
+	S(229), S(220), S(213), S(206), S(201), S(196), S(193), S(191),
+	S(191), S(191), S(193), S(196), S(200), S(205), S(211), S(218),
+	S(226), S(234), S(243), S(253), S(263), S(273), S(283), S(294),
+	S(305), S(315), S(326), S(336), S(346), S(355), S(364), S(372),
+	S(380), S(386), S(392), S(398), S(402), S(405), S(407), S(409),
+	S(409), S(409), S(407), S(405), S(402), S(398), S(393), S(388),
+	S(382), S(375), S(368), S(360), S(352), S(343), S(335), S(326),
+	S(317), S(308), S(300), S(291), S(283), S(276), S(268), S(261),
+	S(255), S(250), S(245), S(240), S(237), S(234), S(232), S(231),
+	S(230), S(231), S(232), S(234), S(237), S(240), S(244), S(249),
+	S(254), S(260), S(266), S(273), S(280), S(287), S(295), S(303),
+	S(310), S(318), S(325), S(333), S(340), S(347), S(353), S(359),
+	S(365), S(370), S(374), S(378), S(381), S(384), S(386), S(387),
+	S(387), S(387), S(386), S(384), S(381), S(378), S(375), S(370),
+	S(365), S(360), S(354), S(348), S(342), S(335), S(328), S(321),
+	S(314), S(307), S(300), S(293), S(287), S(280), S(274), S(269),
+	S(263), S(259), S(255), S(251), S(248), S(246), S(244), S(243),
+	S(243), S(243), S(244), S(246), S(248), S(251), S(254), S(259),
+	S(263), S(268), S(274), S(280), S(286), S(292), S(299), S(306),
+	S(312), S(319), S(326), S(332), S(339), S(345), S(351), S(356),
+	S(361), S(366), S(370), S(373), S(376), S(379), S(380), S(381),
+	S(382), S(381), S(380), S(379), S(376), S(373), S(370), S(366),
+	S(361), S(356), S(351), S(345), S(339), S(332), S(326), S(319),
+	S(312), S(306), S(299), S(292), S(286), S(280), S(274), S(268),
+	S(263), S(259), S(254), S(251), S(248), S(246), S(244), S(243),
+	S(243), S(243), S(244), S(246), S(248), S(251), S(255), S(259),
+	S(263), S(269), S(274), S(280), S(287), S(293), S(300), S(307),
+	S(314), S(321), S(328), S(335), S(342), S(348), S(354), S(360),
+	S(365), S(370), S(375), S(378), S(381), S(384), S(386), S(387),
+	S(387), S(387), S(386), S(384), S(381), S(378), S(374), S(370),
+	S(365), S(359), S(353), S(347), S(340), S(333), S(325), S(318),
+	S(310), S(303), S(295), S(287), S(280), S(273), S(266), S(260),
+	S(254), S(249), S(244), S(240), S(237), S(234), S(232), S(231),
+	S(230), S(231), S(232), S(234), S(237), S(240), S(245), S(250),
+	S(255), S(261), S(268), S(276), S(283), S(291), S(300), S(308),
+	S(317), S(326), S(335), S(343), S(352), S(360), S(368), S(375),
+	S(382), S(388), S(393), S(398), S(402), S(405), S(407), S(409),
+	S(409), S(409), S(407), S(405), S(402), S(398), S(392), S(386),
+	S(380), S(372), S(364), S(355), S(346), S(336), S(326), S(315),
+	S(305), S(294), S(283), S(273), S(263), S(253), S(243), S(234),
+	S(226), S(218), S(211), S(205), S(200), S(196), S(193), S(191),
+	S(191), S(191), S(193), S(196), S(201), S(206), S(213), S(220),
+	S(229), S(239), S(250), S(261), S(274), S(287), S(300), S(314),
+	S(328), S(343), S(357), S(372), S(386), S(400), S(413), S(425),
+	S(437), S(448), S(457), S(466), S(473), S(478), S(483), S(485),
+	S(486), S(485), S(482), S(478), S(472), S(464), S(454), S(442),
+	S(429), S(413), S(397), S(379), S(360), S(339), S(317), S(295),
+	S(272), S(248), S(225), S(201), S(177), S(154), S(131), S(110),
+	S(89), S(70), S(53), S(38), S(25), S(14), S(7), S(2),
+	S(0), S(2), S(7), S(16), S(29), S(47), S(68), S(94),
+	S(124), S(159), S(199), S(243), S(292), S(345), S(403), S(466),
+	S(533), S(604), S(680), S(759), S(842), S(929), S(1019), S(1113),
+	S(1209), S(1308), S(1409), S(1513), S(1617), S(1724), S(1831), S(1939),
+	S(2047), S(2156), S(2264), S(2371), S(2478), S(2582), S(2686), S(2787),
+	S(2886), S(2982), S(3076), S(3166), S(3253), S(3336), S(3415), S(3491),
+	S(3562), S(3629), S(3692), S(3750), S(3803), S(3852), S(3896), S(3936),
+	S(3971), S(4001), S(4027), S(4048), S(4066), S(4079), S(4088), S(4093),
+	S(4095), S(4093), S(4088), S(4081), S(4070), S(4057), S(4042), S(4025),
+	S(4006), S(3985), S(3964), S(3941), S(3918), S(3894), S(3870), S(3847),
+	S(3823), S(3800), S(3778), S(3756), S(3735), S(3716), S(3698), S(3682),
+	S(3666), S(3653), S(3641), S(3631), S(3623), S(3617), S(3613), S(3610),
+	S(3609), S(3610), S(3612), S(3617), S(3622), S(3629), S(3638), S(3647),
+	S(3658), S(3670), S(3682), S(3695), S(3709), S(3723), S(3738), S(3752),
+	S(3767), S(3781), S(3795), S(3808), S(3821), S(3834), S(3845), S(3856),
+	S(3866), S(3875), S(3882), S(3889), S(3894), S(3899), S(3902), S(3904),
+	S(3904), S(3904), S(3902), S(3899), S(3895), S(3890), S(3884), S(3877),
+	S(3869), S(3861), S(3852), S(3842), S(3832), S(3822), S(3812), S(3801),
+	S(3790), S(3780), S(3769), S(3759), S(3749), S(3740), S(3731), S(3723),
+	S(3715), S(3709), S(3703), S(3697), S(3693), S(3690), S(3688), S(3686),
+	S(3686), S(3686), S(3688), S(3690), S(3693), S(3697), S(3702), S(3707),
+	S(3713), S(3720), S(3727), S(3735), S(3743), S(3752), S(3760), S(3769),
+	S(3778), S(3787), S(3795), S(3804), S(3812), S(3819), S(3827), S(3834),
+	S(3840), S(3845), S(3850), S(3855), S(3858), S(3861), S(3863), S(3864),
+	S(3865), S(3864), S(3863), S(3861), S(3858), S(3855), S(3851), S(3846),
+	S(3841), S(3835), S(3829), S(3822), S(3815), S(3808), S(3800), S(3792),
+	S(3785), S(3777), S(3770), S(3762), S(3755), S(3748), S(3742), S(3736),
+	S(3730), S(3725), S(3721), S(3717), S(3714), S(3711), S(3709), S(3708),
+	S(3708), S(3708), S(3709), S(3711), S(3714), S(3717), S(3720), S(3725),
+	S(3730), S(3735), S(3741), S(3747), S(3753), S(3760), S(3767), S(3774),
+	S(3781), S(3788), S(3795), S(3802), S(3808), S(3815), S(3821), S(3826),
+	S(3832), S(3836), S(3840), S(3844), S(3847), S(3849), S(3851), S(3852),
+	S(3852), S(3852), S(3851), S(3849), S(3847), S(3844), S(3841), S(3836),
+	S(3832), S(3827), S(3821), S(3815), S(3809), S(3803), S(3796), S(3789),
+	S(3783), S(3776), S(3769), S(3763), S(3756), S(3750), S(3744), S(3739),
+	S(3734), S(3729), S(3725), S(3722), S(3719), S(3716), S(3715), S(3714),
+	S(3713), S(3714), S(3715), S(3716), S(3719), S(3722), S(3725), S(3729),
+	S(3734), S(3739), S(3744), S(3750), S(3756), S(3763), S(3769), S(3776),
+	S(3783), S(3789), S(3796), S(3803), S(3809), S(3815), S(3821), S(3827),
+	S(3832), S(3836), S(3841), S(3844), S(3847), S(3849), S(3851), S(3852),
+	S(3852), S(3852), S(3851), S(3849), S(3847), S(3844), S(3840), S(3836),
+	S(3832), S(3826), S(3821), S(3815), S(3808), S(3802), S(3795), S(3788),
+	S(3781), S(3774), S(3767), S(3760), S(3753), S(3747), S(3741), S(3735),
+	S(3730), S(3725), S(3720), S(3717), S(3714), S(3711), S(3709), S(3708),
+	S(3708), S(3708), S(3709), S(3711), S(3714), S(3717), S(3721), S(3725),
+	S(3730), S(3736), S(3742), S(3748), S(3755), S(3762), S(3770), S(3777),
+	S(3785), S(3792), S(3800), S(3808), S(3815), S(3822), S(3829), S(3835),
+	S(3841), S(3846), S(3851), S(3855), S(3858), S(3861), S(3863), S(3864),
+	S(3865), S(3864), S(3863), S(3861), S(3858), S(3855), S(3850), S(3845),
+	S(3840), S(3834), S(3827), S(3819), S(3812), S(3804), S(3795), S(3787),
+	S(3778), S(3769), S(3760), S(3752), S(3743), S(3735), S(3727), S(3720),
+	S(3713), S(3707), S(3702), S(3697), S(3693), S(3690), S(3688), S(3686),
+	S(3686), S(3686), S(3688), S(3690), S(3693), S(3697), S(3703), S(3709),
+	S(3715), S(3723), S(3731), S(3740), S(3749), S(3759), S(3769), S(3780),
+	S(3790), S(3801), S(3812), S(3822), S(3832), S(3842), S(3852), S(3861),
+	S(3869), S(3877), S(3884), S(3890), S(3895), S(3899), S(3902), S(3904),
+	S(3904), S(3904), S(3902), S(3899), S(3894), S(3889), S(3882), S(3875),
+	S(3866), S(3856), S(3845), S(3834), S(3821), S(3808), S(3795), S(3781),
+	S(3767), S(3752), S(3738), S(3723), S(3709), S(3695), S(3682), S(3670),
+	S(3658), S(3647), S(3638), S(3629), S(3622), S(3617), S(3612), S(3610),
+	S(3609), S(3610), S(3613), S(3617), S(3623), S(3631), S(3641), S(3653),
+	S(3666), S(3682), S(3698), S(3716), S(3735), S(3756), S(3778), S(3800),
+	S(3823), S(3847), S(3870), S(3894), S(3918), S(3941), S(3964), S(3985),
+	S(4006), S(4025), S(4042), S(4057), S(4070), S(4081), S(4088), S(4093),
+	S(4095), S(4093), S(4088), S(4079), S(4066), S(4048), S(4027), S(4001),
+	S(3971), S(3936), S(3896), S(3852), S(3803), S(3750), S(3692), S(3629),
+	S(3562), S(3491), S(3415), S(3336), S(3253), S(3166), S(3076), S(2982),
+	S(2886), S(2787), S(2686), S(2582), S(2478), S(2371), S(2264), S(2156)
+};
+
+//sawtooth then square, indexed by level
+const sample_t* const BandLimitTables[FLASH_BANDLIMIT_SHAPES][FLASH_BANDLIMIT_LEVELS] =
+{
+	{SawToothBand256, SawToothBand128, SawToothBand64, SawToothBand32, SawToothBand16},
+	{SquareBand256, SquareBand128, SquareBand64, SquareBand32, SquareBand16}
+};
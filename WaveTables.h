@@ -0,0 +1,18 @@
+/* Generated by tools/gen_wavetables.py, do not edit */
+
+#ifndef WAVETABLES_H
+#define WAVETABLES_H
+
+#define FLASH_TABLE_MIN_BITS		6
+#define FLASH_TABLE_MAX_BITS		10
+#define FLASH_TABLE_AMPLITUDE		4095
+#define FLASH_TABLE_SHAPES			3
+
+/* Band-limited sawtooth and square, level k holds the harmonics up to
+ * FLASH_BANDLIMIT_MAX_HARMONIC>>k */
+#define FLASH_BANDLIMIT_BITS		10
+#define FLASH_BANDLIMIT_MAX_HARMONIC	256u
+#define FLASH_BANDLIMIT_LEVELS		5
+#define FLASH_BANDLIMIT_SHAPES		2
+
+#endif
@@ -0,0 +1,313 @@
+#include "WaveGenPriv.h"
+
+
+/* Arbitrary waveform upload over the serial port. The host sends frames of
+ *
+ *	SYNC kind length payload[length] sum1 sum2
+ *
+ * where sum1 and sum2 are the Fletcher-16 sums over kind, length and the
+ * payload. Every frame is answered with UPLOAD_ACK or UPLOAD_NAK and a
+ * NAKed frame may be sent again.
+ *
+ *	'H'	sample count, 16 bit little endian, starts a new upload
+ *	'D'	sequence number, then samples as zigzag varint deltas from the
+ *		previous sample, the first one from 0
+ *	'E'	Fletcher-16 over all samples as 16 bit little endian words
+ *
+ * Samples are 12 bit codes at full scale, most deltas of a smooth shape
+ * take a single byte. The upload is decoded into the spare shape buffer
+ * and only replaces the current shape after the end frame verified it.
+ * tools/upload_waveform.py is the host side. */
+
+#define UPLOAD_SYNC				0xA5
+#define UPLOAD_ACK				0x06
+#define UPLOAD_NAK				0x15
+
+#define UPLOAD_FRAME_HEADER		'H'
+#define UPLOAD_FRAME_DATA		'D'
+#define UPLOAD_FRAME_END		'E'
+
+#define UPLOAD_MAX_PAYLOAD		255
+
+struct UPLOAD_FRAME
+{
+	uint8_t kind;
+	uint8_t length;
+	uint8_t payload[UPLOAD_MAX_PAYLOAD];
+};
+
+//one shape is in use, the other takes the next upload
+static uint16_t UploadShape[2][UPLOAD_MAX_SAMPLE];
+static uint8_t ShapeBank;
+static uint32_t ShapeLength;
+
+static int (*UploadRead)(unsigned char* input);
+static uint32_t (*UploadMillis)(void);
+
+static void Upload_Fletcher(uint32_t* pSum1, uint32_t* pSum2, uint8_t data)
+{
+	*pSum1 += data;
+	if(*pSum1>=255)
+		*pSum1 -= 255;
+	*pSum2 += *pSum1;
+	if(*pSum2>=255)
+		*pSum2 -= 255;
+}
+
+static uint8_t Upload_ReadByte(uint8_t* pData, uint32_t timeout_ms)
+{
+	uint32_t start;
+
+	start = UploadMillis();
+	while(UploadRead(pData))
+	{
+		if(UploadMillis()-start>timeout_ms)
+			return 0;
+	}
+
+	return 1;
+}
+
+/* Returns 1 for a good frame, 0 for a bad checksum and -1 on timeout */
+static int Upload_ReadFrame(struct UPLOAD_FRAME* pFrame, uint32_t timeout_ms)
+{
+	uint32_t sum1;
+	uint32_t sum2;
+	uint8_t check1;
+	uint8_t check2;
+	uint8_t data;
+	uint32_t i;
+
+	do
+	{
+		if(!Upload_ReadByte(&data,timeout_ms))
+			return -1;
+	}
+	while(data!=UPLOAD_SYNC);
+
+	if(!Upload_ReadByte(&pFrame->kind,UPLOAD_TIMEOUT_MS)||
+		!Upload_ReadByte(&pFrame->length,UPLOAD_TIMEOUT_MS))
+		return -1;
+
+	for(i=0;i<pFrame->length;i++)
+	{
+		if(!Upload_ReadByte(&pFrame->payload[i],UPLOAD_TIMEOUT_MS))
+			return -1;
+	}
+
+	if(!Upload_ReadByte(&check1,UPLOAD_TIMEOUT_MS)||
+		!Upload_ReadByte(&check2,UPLOAD_TIMEOUT_MS))
+		return -1;
+
+	sum1 = 0;
+	sum2 = 0;
+	Upload_Fletcher(&sum1,&sum2,pFrame->kind);
+	Upload_Fletcher(&sum1,&sum2,pFrame->length);
+	for(i=0;i<pFrame->length;i++)
+		Upload_Fletcher(&sum1,&sum2,pFrame->payload[i]);
+
+	return (sum1==check1&&sum2==check2)?1:0;
+}
+
+/* Decodes the deltas of a data frame after pShape[*pReceived-1]. Nothing
+ * is counted unless the whole frame decodes into range. */
+static uint8_t Upload_Decode(const struct UPLOAD_FRAME* pFrame, uint16_t* pShape, uint32_t expected, uint32_t* pReceived)
+{
+	uint32_t received;
+	uint32_t zigzag;
+	uint32_t shift;
+	int32_t sample;
+	uint32_t i;
+
+	received = *pReceived;
+	sample = received?pShape[received-1]:0;
+
+	//payload[0] is the sequence number
+	i = 1;
+	while(i<pFrame->length)
+	{
+		zigzag = 0;
+		shift = 0;
+		do
+		{
+			//a 12 bit delta never needs more than two bytes
+			if(i>=pFrame->length||shift>7)
+				return 0;
+			zigzag |= (uint32_t)(pFrame->payload[i]&0x7F)<<shift;
+			shift += 7;
+		}
+		while(pFrame->payload[i++]&0x80);
+
+		sample += (zigzag&1)?-(int32_t)((zigzag+1)>>1):(int32_t)(zigzag>>1);
+		if(sample<0||sample>DAC_RESOLUTION-1||received>=expected)
+			return 0;
+
+		pShape[received++]=(uint16_t)sample;
+	}
+
+	*pReceived = received;
+	return 1;
+}
+
+static uint8_t Upload_Verify(const struct UPLOAD_FRAME* pFrame, const uint16_t* pShape, uint32_t expected)
+{
+	uint32_t sum1;
+	uint32_t sum2;
+	uint32_t i;
+
+	if(pFrame->length!=2)
+		return 0;
+
+	sum1 = 0;
+	sum2 = 0;
+	for(i=0;i<expected;i++)
+	{
+		Upload_Fletcher(&sum1,&sum2,pShape[i]&0xFF);
+		Upload_Fletcher(&sum1,&sum2,pShape[i]>>8);
+	}
+
+	return sum1==pFrame->payload[0]&&sum2==pFrame->payload[1];
+}
+
+/* Receives a shape, blocking until it is verified or the line stays idle
+ * for UPLOAD_TIMEOUT_MS. Returns the number of samples, or 0 with the
+ * previous shape left in place. The new shape plays from the next
+ * GenerateWaveform with WAVEFORM_TYPE_ARBITRARY. */
+uint32_t UploadWaveform(int (*read)(unsigned char* input), unsigned char (*write)(unsigned char output), uint32_t (*millis)(void))
+{
+	struct UPLOAD_FRAME frame;
+	uint16_t* pShape;
+	uint32_t expected;
+	uint32_t received;
+	uint32_t timeout_ms;
+	uint8_t sequence;
+	uint8_t ok;
+	int ret;
+
+	UploadRead = read;
+	UploadMillis = millis;
+
+	pShape = Upload_SpareShape();
+	expected = 0;
+	received = 0;
+	sequence = 0;
+	timeout_ms = UPLOAD_START_TIMEOUT_MS;
+
+	while(1)
+	{
+		ret = Upload_ReadFrame(&frame,timeout_ms);
+		if(ret<0)
+			return 0;
+		timeout_ms = UPLOAD_TIMEOUT_MS;
+
+		ok = 0;
+		if(ret)
+		{
+			switch(frame.kind)
+			{
+				case UPLOAD_FRAME_HEADER:
+					if(frame.length==2)
+					{
+						expected = frame.payload[0]|((uint32_t)frame.payload[1]<<8);
+						if(expected<2||expected>UPLOAD_MAX_SAMPLE)
+							expected = 0;
+						received = 0;
+						sequence = 0;
+						ok = (expected!=0);
+					}
+				break;
+				case UPLOAD_FRAME_DATA:
+					if(expected==0||frame.length<1)
+						break;
+
+					//the ACK for the last frame got lost, it was already taken
+					if(frame.payload[0]==(uint8_t)(sequence-1)&&received)
+					{
+						ok = 1;
+					}
+					else if(frame.payload[0]==sequence&&Upload_Decode(&frame,pShape,expected,&received))
+					{
+						sequence++;
+						ok = 1;
+					}
+				break;
+				case UPLOAD_FRAME_END:
+					if(expected&&received==expected&&Upload_Verify(&frame,pShape,expected))
+					{
+						Upload_Commit(expected);
+						write(UPLOAD_ACK);
+						return expected;
+					}
+				break;
+				default:
+				break;
+			}
+		}
+
+		write(ok?UPLOAD_ACK:UPLOAD_NAK);
+	}
+}
+
+uint32_t GetUploadLength(void)
+{
+	return ShapeLength;
+}
+
+/* The shape buffer not in use, UPLOAD_MAX_SAMPLE long. Whatever is
+ * written there plays once Upload_Commit swaps it in. */
+uint16_t* Upload_SpareShape(void)
+{
+	return UploadShape[ShapeBank^1];
+}
+
+void Upload_Commit(uint32_t length)
+{
+	ShapeBank ^= 1;
+	ShapeLength = length;
+	Cache_Forget(WAVEFORM_TYPE_ARBITRARY);
+}
+
+/* Resamples the uploaded shape to NoOfSample points with linear
+ * interpolation and scales it from full scale to the amplitude. A table
+ * as long as the shape is the shape itself. */
+void GenerateArbitraryTable(sample_t* pTable, uint32_t NoOfSample, uint32_t Amplitude_In_Resolution)
+{
+	const uint16_t* pShape;
+	uint32_t position;
+	uint32_t step;
+	uint32_t scale;
+	uint32_t index;
+	uint32_t next;
+	uint32_t frac;
+	uint32_t code;
+	uint32_t i;
+
+	pShape = UploadShape[ShapeBank];
+	if(ShapeLength==0)
+	{
+		for(i=0;i<NoOfSample;i++)
+			pTable[i]=0;
+		return;
+	}
+
+	step = ((ShapeLength<<16)+NoOfSample/2)/NoOfSample;
+	scale = ((Amplitude_In_Resolution<<16)+(DAC_RESOLUTION-1)/2)/(DAC_RESOLUTION-1);
+
+	position = 0;
+	for(i=0;i<NoOfSample;i++)
+	{
+		index = position>>16;
+		if(index>=ShapeLength)
+			index -= ShapeLength;
+		next = (index+1<ShapeLength)?index+1:0;
+		frac = position&0xFFFF;
+
+		code = (pShape[index]*(0x10000-frac)+pShape[next]*frac+0x8000)>>16;
+		code = (code*scale+0x8000)>>16;
+		if(code>Amplitude_In_Resolution)
+			code = Amplitude_In_Resolution;
+		pTable[i]=TO_SAMPLE(code);
+
+		position += step;
+	}
+}
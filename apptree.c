@@ -518,3 +518,21 @@ int apptree_handle_input(void)
 	
 	return 0;
 }
+
+/** @brief Gets the position of the select arrow
+ *	@param parent Set to the node whose children are on screen.
+ *	@param child_idx Set to the index of the child under the arrow.
+ *	@returns 0 if successful and -1 if otherwise.
+ *
+ *	This lets the application prepare for the child under the arrow before
+ *	it is selected.
+ */
+int apptree_get_selection(struct apptree_node **parent, int *child_idx)
+{
+	if (!control.enabled)
+		return -1;
+	
+	*parent = control.current;
+	*child_idx = control.select_pos;
+	return 0;
+}
@@ -88,5 +88,6 @@ int apptree_init(struct apptree_node **master,
 							
 int apptree_enable(void);
 int apptree_handle_input(void);
+int apptree_get_selection(struct apptree_node **parent, int *child_idx);
 									
 #endif	/* APPTREE_H */
@@ -23,6 +23,9 @@
 #define DMA_CHN			3
 #define DMA_DATA_SIZE	20
 
+/** Time the cursor rests on a waveform before its table is built */
+#define PRECOMPUTE_DWELL_MS	200
+
 
 /** Systick counter */
 volatile uint32_t msTicks;
@@ -93,7 +96,8 @@ enum waveform {
 	SINE 	 = 0,
 	SAWTOOTH	 = 1,
 	TRIANGLE = 2,
-	SQUARE = 3
+	SQUARE = 3,
+	ARBITRARY = 4
 };
 
 struct system_settings {
@@ -143,6 +147,12 @@ void change_waveform(struct apptree_node *parent, int child_idx)
 		return;
 	}
 	
+	/* Only squares reach past the DAC, on the PWM pin */
+	if (settings.frequency > GetMaxFreq((enum WAVEFORM_TYPES)settings.wave)) {
+		settings.frequency = GetMaxFreq((enum WAVEFORM_TYPES)settings.wave);
+		printf("Frequency limited to %d!\r\n", settings.frequency);
+	}
+	
 	printf("Press any key to continue ...\r\n");
 	getchar();
 	
@@ -157,7 +167,7 @@ void change_frequency(struct apptree_node *parent, int child_idx)
 	int ret;
 	
 	//max_freq = 2000;
-	max_freq = GetMaxFreq();
+	max_freq = GetMaxFreq((enum WAVEFORM_TYPES)settings.wave);
 	//min_freq = 1;
 	min_freq = GetMinFreq();
 	
@@ -272,15 +282,599 @@ void print_status(struct apptree_node *parent, int child_idx)
 		settings.wave = SAWTOOTH;
 		printf("\tWaveform:\tSAWTOOTH\r\n");
 		break;
+	case ARBITRARY:
+		printf("\tWaveform:\tARBITRARY (%u samples)\r\n",
+				GetUploadLength());
+		break;
 	default:
 		return;
 	}
 	
 	printf("\tFrequency:\t%d\r\n", settings.frequency);
+	printf("\tAchieved:\t%u.%03u\r\n", GetActualFrequencyMilliHz()/1000,
+			GetActualFrequencyMilliHz()%1000);
 	printf("\tAmplitude:\t%.1f\r\n", settings.amplitude);
+	if (IsPWMOutput())
+		printf("\tOutput:\t\tPWM on PA6, %u%% duty\r\n", GetDutyCycle());
+	printf("\tCache:\t\t%u hits, %u misses\r\n", GetCacheHits(),
+			GetCacheMisses());
+	printf("\r\n");
+	printf("Press any key to continue ...\r\n");
+	getchar();
+}
+
+uint32_t get_ticks(void)
+{
+	return msTicks;
+}
+
+void change_duty(struct apptree_node *parent, int child_idx)
+{
+	unsigned int new_duty;
+	int ret;
+
+	print_blankscreen();
+
+repeat:
+	printf("Current duty cycle: %u%%\r\n", GetDutyCycle());
+	/* The other shapes only have the DAC */
+	printf("Square waves above %d are PWM on PA6\r\n",
+			GetMaxFreq(WAVEFORM_TYPE_SINE));
+	printf("\r\n");
+	printf("Enter new duty cycle (1 to 99): ");
+
+	ret = scanf("%d", &new_duty);
+	printf("\r\n");
+
+	if (ret <= 0 || !SetDutyCycle(new_duty)) {
+		printf("Error! Invalid input\r\n");
+		printf("\r\n");
+		goto repeat;
+	}
+
+	printf("Duty cycle changed to %d%%!\r\n", new_duty);
+	printf("Press any key to continue ...\r\n");
+	getchar();
+}
+
+void change_speed(struct apptree_node *parent, int child_idx)
+{
+	unsigned int mode;
+	unsigned int min_sample;
+	int ret;
+
+	print_blankscreen();
+
+repeat:
+	printf("Current mode: %s\r\n",
+			GetSpeedMode() == WAVEGEN_SPEED_HIGH ? "HIGH" : "NORMAL");
+	printf("High speed trades samples per cycle for frequency,\r\n");
+	printf("down to a floor of %d to %d samples\r\n", HIGH_SPEED_MIN_SAMPLE,
+			MIN_SAMPLE_PER_CYCLE);
+	printf("\r\n");
+	printf("Enter mode (0 normal, 1 high) and floor: ");
+
+	ret = scanf("%d %d", &mode, &min_sample);
+	printf("\r\n");
+
+	if (ret < 2 || mode > WAVEGEN_SPEED_HIGH ||
+			!SetSpeedMode((enum WAVEGEN_SPEED_MODES)mode, min_sample)) {
+		printf("Error! Invalid input\r\n");
+		printf("\r\n");
+		goto repeat;
+	}
+
+	/* Keep the frequency within the new limit */
+	if (settings.frequency > GetMaxFreq((enum WAVEFORM_TYPES)settings.wave))
+		settings.frequency = GetMaxFreq((enum WAVEFORM_TYPES)settings.wave);
+
+	printf("Maximum frequency is now %d!\r\n",
+			GetMaxFreq((enum WAVEFORM_TYPES)settings.wave));
+	printf("Press any key to continue ...\r\n");
+	getchar();
+
+	settings.changed = true;
+}
+
+void builtin_wave(struct apptree_node *parent, int child_idx)
+{
+	unsigned int wave;
+	unsigned int new_freq;
+	uint32_t achieved;
+	int ret;
+
+	print_blankscreen();
+
+repeat:
+	printf("Maximum triangle frequency: %d\r\n",
+			GetBuiltinMaxFreq(WAVEGEN_BUILTIN_TRIANGLE, settings.amplitude));
+	printf("Maximum noise update rate: %d\r\n",
+			GetBuiltinMaxFreq(WAVEGEN_BUILTIN_NOISE, settings.amplitude));
+	printf("\r\n");
+	printf("Enter wave (0 triangle, 1 noise) and frequency: ");
+
+	ret = scanf("%d %d", &wave, &new_freq);
+	printf("\r\n");
+
+	if (ret < 2 || wave > WAVEGEN_BUILTIN_NOISE) {
+		printf("Error! Invalid input\r\n");
+		printf("\r\n");
+		goto repeat;
+	}
+
+	if (new_freq > GetBuiltinMaxFreq((enum WAVEGEN_BUILTIN_WAVES)wave,
+			settings.amplitude)) {
+		printf("Error! Value exceeded maximum limit!\r\n");
+		printf("\r\n");
+		goto repeat;
+	}
+
+	achieved = StartBuiltinWave((enum WAVEGEN_BUILTIN_WAVES)wave,
+			new_freq * 1000, settings.amplitude);
+	if (!achieved) {
+		printf("Error! Frequency out of range!\r\n");
+		printf("\r\n");
+		goto repeat;
+	}
+
+	printf("Playing at %u.%03u until the next change!\r\n",
+			achieved / 1000, achieved % 1000);
+	printf("Press any key to continue ...\r\n");
+	getchar();
+}
+
+void upload_waveform(struct apptree_node *parent, int child_idx)
+{
+	uint32_t length;
+
+	print_blankscreen();
+
+	printf("Waiting for upload, run tools/upload_waveform.py now ...\r\n");
+	length = UploadWaveform(&SER_GetChar_nonBlocking, &SER_PutChar, &get_ticks);
+
+	if (length) {
+		printf("\r\nUploaded %u samples!\r\n", length);
+		settings.wave = ARBITRARY;
+		settings.changed = true;
+	} else {
+		printf("\r\nUpload failed, waveform unchanged!\r\n");
+	}
+
+	printf("Press any key to continue ...\r\n");
+	getchar();
+}
+
+void set_harmonics(struct apptree_node *parent, int child_idx)
+{
+	struct WAVEGEN_HARMONIC harmonics[SPECTRUM_MAX_HARMONICS];
+	unsigned int number;
+	unsigned int amplitude;
+	unsigned int phase;
+	unsigned int count;
+	int ret;
+
+	print_blankscreen();
+
+repeat:
+	printf("Harmonics 1 to %d, up to %d of them\r\n", SPECTRUM_SIZE / 2 - 1,
+			SPECTRUM_MAX_HARMONICS);
+	printf("Amplitudes are relative, phases in degrees from sine\r\n");
+	printf("\r\n");
+	printf("Enter harmonic, amplitude and phase, 0 0 0 to finish:\r\n");
+
+	count = 0;
+	while (1) {
+		ret = scanf("%d %d %d", &number, &amplitude, &phase);
+		if (ret < 3 || (number == 0 && amplitude == 0 && phase == 0))
+			break;
+		if (count == SPECTRUM_MAX_HARMONICS || amplitude > 0xFFFF) {
+			ret = 0;
+			break;
+		}
+		harmonics[count].number = number;
+		harmonics[count].amplitude = amplitude;
+		harmonics[count].phase_degree = phase;
+		count++;
+	}
+	printf("\r\n");
+
+	if (ret < 3 || !SetHarmonics(harmonics, count)) {
+		printf("Error! Invalid input\r\n");
+		printf("\r\n");
+		goto repeat;
+	}
+
+	printf("Built %d harmonics into the arbitrary waveform!\r\n", count);
+	printf("Press any key to continue ...\r\n");
+	getchar();
+
+	settings.wave = ARBITRARY;
+	settings.changed = true;
+}
+
+void run_sequence(struct apptree_node *parent, int child_idx)
+{
+	struct WAVEGEN_SEGMENT segments[SEQUENCE_MAX_SEGMENTS];
+	unsigned int wave;
+	unsigned int frequency;
+	float amplitude;
+	unsigned int cycles;
+	unsigned int duration;
+	unsigned int count;
+	unsigned int loop;
+	int ret;
+
+	print_blankscreen();
+
+repeat:
+	printf("Waves 0 sine, 1 sawtooth, 2 triangle, 3 square, 4 arbitrary\r\n");
+	printf("Frequencies up to %d, up to %d segments\r\n", MAX_FREQUENCY,
+			SEQUENCE_MAX_SEGMENTS);
+	printf("A segment lasts its cycles, or its ms when cycles is 0\r\n");
+	printf("\r\n");
+	printf("Enter wave, frequency, amplitude, cycles and ms,\r\n");
+	printf("0 0 0 0 0 to finish:\r\n");
+
+	count = 0;
+	while (1) {
+		ret = scanf("%d %d %f %d %d", &wave, &frequency, &amplitude, &cycles,
+				&duration);
+		if (ret < 5 || frequency == 0)
+			break;
+		if (count == SEQUENCE_MAX_SEGMENTS || wave > ARBITRARY) {
+			ret = 0;
+			break;
+		}
+		segments[count].waveform_types = (enum WAVEFORM_TYPES)wave;
+		segments[count].frequency = frequency;
+		segments[count].amplitude = amplitude;
+		segments[count].cycles = cycles;
+		segments[count].duration_ms = duration;
+		count++;
+	}
+	printf("\r\n");
+
+	if (ret == 5) {
+		printf("Loop the sequence (0 no, 1 yes): ");
+		ret = scanf("%d", &loop);
+		printf("\r\n");
+	} else {
+		ret = 0;
+	}
+
+	if (ret < 1 || !StartSequence(segments, count, loop)) {
+		printf("Error! Invalid input\r\n");
+		printf("\r\n");
+		goto repeat;
+	}
+
+	printf("Playing %d segments until the next change!\r\n", count);
+	printf("Press any key to continue ...\r\n");
+	getchar();
+}
+
+void run_length(struct apptree_node *parent, int child_idx)
+{
+	struct WAVEGEN_RUN runs[RUNLENGTH_MAX_RUNS];
+	unsigned int level;
+	unsigned int duration;
+	unsigned int count;
+	uint32_t achieved;
+	int ret;
+
+	print_blankscreen();
+
+repeat:
+	printf("Levels 0 to 4095 at full scale, durations in us\r\n");
+	printf("Between 2 and %d runs, played in a loop\r\n", RUNLENGTH_MAX_RUNS);
+	printf("\r\n");
+	printf("Enter level and duration, 0 0 to finish:\r\n");
+
+	count = 0;
+	while (1) {
+		ret = scanf("%u %u", &level, &duration);
+		if (ret < 2 || duration == 0)
+			break;
+		if (count == RUNLENGTH_MAX_RUNS || level > DAC_RESOLUTION - 1 ||
+				duration > 0xFFFF) {
+			ret = 0;
+			break;
+		}
+		runs[count].level = level;
+		runs[count].ticks = duration;
+		count++;
+	}
 	printf("\r\n");
+
+	/* One tick per microsecond */
+	achieved = 0;
+	if (ret == 2)
+		achieved = StartRunLength(runs, count, SystemCoreClock / 1000000 - 1,
+				settings.amplitude);
+	if (!achieved) {
+		printf("Error! Invalid input\r\n");
+		printf("\r\n");
+		goto repeat;
+	}
+
+	printf("Playing at %u.%03u until the next change!\r\n",
+			achieved / 1000, achieved % 1000);
+	printf("Press any key to continue ...\r\n");
+	getchar();
+}
+
+void stream_waveform(struct apptree_node *parent, int child_idx)
+{
+	unsigned int max_rate;
+	unsigned int new_rate;
+	uint32_t samples;
+	int ret;
+
+	max_rate = GetStreamMaxRate();
+
+	print_blankscreen();
+
+repeat:
+	printf("Maximum sustainable sample rate: %d\r\n", max_rate);
+	printf("\r\n");
+	printf("Enter sample rate: ");
+
+	ret = scanf("%d", &new_rate);
+	printf("\r\n");
+
+	if (ret <= 0 || new_rate == 0) {
+		printf("Error! Invalid input\r\n");
+		printf("\r\n");
+		goto repeat;
+	}
+
+	if (new_rate > max_rate) {
+		printf("Error! Value exceeded maximum limit!\r\n");
+		printf("\r\n");
+		goto repeat;
+	}
+
+	printf("Send unsigned 16 bit little endian samples now ...\r\n");
+	samples = StreamWaveform(new_rate, &get_ticks);
+
+	printf("\r\nStreamed %u samples, %u underruns!\r\n", samples,
+			GetStreamUnderruns());
 	printf("Press any key to continue ...\r\n");
 	getchar();
+
+	/* Restore the selected waveform */
+	settings.changed = true;
+}
+
+void key_waveform(struct apptree_node *parent, int child_idx)
+{
+	unsigned int max_rate;
+	unsigned int keying;
+	unsigned int rate;
+	unsigned int freq;
+	unsigned int freq_one;
+	uint32_t symbols;
+	int ret;
+
+	max_rate = GetKeyingMaxRate();
+
+	print_blankscreen();
+
+repeat:
+	printf("Maximum sustainable symbol rate: %d\r\n", max_rate);
+	printf("Carriers are rounded to multiples of the symbol rate\r\n");
+	printf("\r\n");
+	printf("Enter keying (0 FSK, 1 BPSK, 2 OOK), symbol rate,\r\n");
+	printf("carrier and, for FSK, the tone of 1: ");
+
+	ret = scanf("%d %d %d", &keying, &rate, &freq);
+	if (ret == 3 && keying == WAVEGEN_KEYING_FSK)
+		ret = scanf("%d", &freq_one) == 1 ? 3 : 0;
+	else
+		freq_one = freq;
+	printf("\r\n");
+
+	if (ret < 3 || keying > WAVEGEN_KEYING_OOK || rate == 0) {
+		printf("Error! Invalid input\r\n");
+		printf("\r\n");
+		goto repeat;
+	}
+
+	if (rate > max_rate) {
+		printf("Error! Value exceeded maximum limit!\r\n");
+		printf("\r\n");
+		goto repeat;
+	}
+
+	printf("Send the bitstream now, most significant bit first ...\r\n");
+	symbols = KeyWaveform((enum WAVEGEN_KEYINGS)keying, rate, freq,
+			freq_one, settings.amplitude, &get_ticks);
+
+	if (symbols == 0)
+		printf("\r\nError! Carrier out of range or no data!\r\n");
+	else
+		printf("\r\nKeyed %u symbols at %u.%03u baud, %u underruns!\r\n",
+				symbols, GetKeyingRateMilliHz() / 1000,
+				GetKeyingRateMilliHz() % 1000, GetKeyingUnderruns());
+	printf("Press any key to continue ...\r\n");
+	getchar();
+
+	/* Restore the selected waveform */
+	settings.changed = true;
+}
+
+void sweep_frequency(struct apptree_node *parent, int child_idx)
+{
+	unsigned int start_freq;
+	unsigned int stop_freq;
+	unsigned int steps;
+	unsigned int dwell;
+	unsigned int spacing;
+	int ret;
+
+	print_blankscreen();
+
+repeat:
+	/* Sweeps stay on the DAC */
+	printf("Maximum allowable frequency: %d\r\n",
+			GetMaxFreq(WAVEFORM_TYPE_SINE));
+	printf("Minimum allowable frequency: %d\r\n", GetMinFreq());
+	printf("Maximum number of steps: %d\r\n", SWEEP_MAX_STEPS);
+	printf("\r\n");
+	printf("Enter start frequency, stop frequency, steps, dwell in ms\r\n");
+	printf("and spacing (0 linear, 1 log): ");
+
+	ret = scanf("%d %d %d %d %d", &start_freq, &stop_freq, &steps, &dwell,
+			&spacing);
+	printf("\r\n");
+
+	if (ret < 5 || spacing > 1) {
+		printf("Error! Invalid input\r\n");
+		printf("\r\n");
+		goto repeat;
+	}
+
+	if (!StartSweep((enum WAVEFORM_TYPES)settings.wave, start_freq,
+			stop_freq, steps, dwell, (enum WAVEGEN_SWEEP_SPACINGS)spacing,
+			settings.amplitude)) {
+		printf("Error! Sweep out of range!\r\n");
+		printf("\r\n");
+		goto repeat;
+	}
+
+	printf("Sweeping until the next change!\r\n");
+	printf("Press any key to continue ...\r\n");
+	getchar();
+}
+
+void modulate_output(struct apptree_node *parent, int child_idx)
+{
+	unsigned int modulation;
+	unsigned int rate;
+	unsigned int depth;
+	int ret;
+
+	print_blankscreen();
+
+repeat:
+	printf("Maximum modulation rate: %d\r\n", DDS_MAX_FREQUENCY);
+	printf("AM depth in percent up to 100, FM deviation up to %d\r\n",
+			DDS_MAX_FREQUENCY);
+	printf("\r\n");
+	printf("Enter modulation (0 off, 1 AM, 2 FM), rate and depth: ");
+
+	ret = scanf("%d %d %d", &modulation, &rate, &depth);
+	printf("\r\n");
+
+	if (ret < 3 || modulation > WAVEGEN_MODULATION_FM) {
+		printf("Error! Invalid input\r\n");
+		printf("\r\n");
+		goto repeat;
+	}
+
+	if (!SetModulation((enum WAVEGEN_MODULATIONS)modulation,
+			WAVEFORM_TYPE_SINE, rate * 1000, depth)) {
+		printf("Error! Modulation out of range!\r\n");
+		printf("\r\n");
+		goto repeat;
+	}
+
+	/* Only the DDS engine modulates */
+	SetEngine(modulation ? WAVEGEN_ENGINE_DDS : WAVEGEN_ENGINE_TABLE);
+
+	/* The DDS engine tops out lower */
+	if (settings.frequency > GetMaxFreq((enum WAVEFORM_TYPES)settings.wave))
+		settings.frequency = GetMaxFreq((enum WAVEFORM_TYPES)settings.wave);
+
+	if (modulation)
+		printf("Modulation on, maximum frequency is now %d!\r\n",
+				GetMaxFreq((enum WAVEFORM_TYPES)settings.wave));
+	else
+		printf("Modulation off!\r\n");
+	printf("Press any key to continue ...\r\n");
+	getchar();
+
+	settings.changed = true;
+}
+
+void burst_output(struct apptree_node *parent, int child_idx)
+{
+	unsigned int cycles;
+	unsigned int trigger;
+	int ret;
+
+	print_blankscreen();
+
+repeat:
+	printf("Maximum number of cycles: %d\r\n", BURST_MAX_CYCLES);
+	printf("\r\n");
+	printf("Enter cycles per burst and trigger\r\n");
+	printf("(0 key only, 1 button rising, 2 button falling): ");
+
+	ret = scanf("%d %d", &cycles, &trigger);
+	printf("\r\n");
+
+	if (ret < 2 || trigger > WAVEGEN_TRIGGER_FALLING) {
+		printf("Error! Invalid input\r\n");
+		printf("\r\n");
+		goto repeat;
+	}
+
+	if (!ArmBurst((enum WAVEFORM_TYPES)settings.wave, settings.frequency,
+			settings.amplitude, cycles, (enum WAVEGEN_TRIGGERS)trigger)) {
+		printf("Error! Burst out of range!\r\n");
+		printf("\r\n");
+		goto repeat;
+	}
+
+	printf("Armed, press t to trigger or any other key to continue ...\r\n");
+	while (getchar() == 't')
+		TriggerBurst();
+
+	printf("%u bursts played, armed until the next change!\r\n",
+			GetBurstCount());
+	printf("Press any key to continue ...\r\n");
+	getchar();
+}
+
+/** @brief Builds the table of the waveform under the cursor ahead of time
+ *	@param waveform_menu The node holding the waveform options.
+ *
+ *	Once the cursor has rested on a waveform option for PRECOMPUTE_DWELL_MS,
+ *	the table it would play at the current frequency and amplitude is built
+ *	into free cache room, so selecting it only has to restart the DMA. An
+ *	option the cursor passes over costs nothing, and a table that is never
+ *	selected takes no other table's place.
+ */
+void precompute_waveform(struct apptree_node *waveform_menu)
+{
+	static struct apptree_node *rest_parent;
+	static int rest_idx = -1;
+	static uint32_t rest_start;
+	static bool rest_done;
+	struct apptree_node *parent;
+	int idx;
+
+	if (apptree_get_selection(&parent, &idx) < 0)
+		return;
+
+	if (parent != rest_parent || idx != rest_idx) {
+		rest_parent = parent;
+		rest_idx = idx;
+		rest_start = msTicks;
+		rest_done = false;
+		return;
+	}
+
+	if (rest_done || parent != waveform_menu ||
+			(msTicks - rest_start) < PRECOMPUTE_DWELL_MS)
+		return;
+
+	/* The options are in the order of enum waveform */
+	rest_done = true;
+	if ((enum waveform)idx != settings.wave)
+		PrecomputeWaveform((enum WAVEFORM_TYPES)idx, settings.frequency,
+				settings.amplitude);
 }
 
 int read(char *input)
@@ -301,6 +895,18 @@ int main (void)
 	struct apptree_node *n_frequency;
 	struct apptree_node *n_amplitude;
 	struct apptree_node *n_status;
+	struct apptree_node *n_upload;
+	struct apptree_node *n_harmonics;
+	struct apptree_node *n_stream;
+	struct apptree_node *n_keying;
+	struct apptree_node *n_sweep;
+	struct apptree_node *n_modulate;
+	struct apptree_node *n_burst;
+	struct apptree_node *n_duty;
+	struct apptree_node *n_speed;
+	struct apptree_node *n_builtin;
+	struct apptree_node *n_runs;
+	struct apptree_node *n_sequence;
 	
 	struct apptree_node *n_sine;
 	struct apptree_node *n_square;
@@ -319,17 +925,33 @@ int main (void)
 	keys.back 	= 'j';
 	keys.home 	= 'u';
 	
-	apptree_init(&n_master, "Simple Waveform Generator v0.1", &keys, &read);
-	
-	apptree_create_node(&n_waveform, n_master, "Waveform", "Change output waveform", NULL);
-	apptree_create_node(&n_frequency, n_master, "Frequency", "Change output frequency", &change_frequency);
-	apptree_create_node(&n_amplitude, n_master, "Amplitude", "Change output amplitude", &change_amplitude);
-	apptree_create_node(&n_status, n_master, "Status", "View system status", &print_status);
-	
-	apptree_create_node(&n_sine, n_waveform, "Sine", "Change to sine wave", &change_waveform);
-	apptree_create_node(&n_square, n_waveform, "Sawtooth", "Change to square wave", &change_waveform);
-	apptree_create_node(&n_triangle, n_waveform, "Triangle", "Change to triangle wave", &change_waveform);
-	apptree_create_node(&n_sawtooth, n_waveform, "Square", "Change to sawtooth wave", &change_waveform);
+	/* The nodes are allocated from the heap, Heap_Size in the startup file
+	 * holds all of them. Stop at the first failure, its children would
+	 * have no parent. */
+	if (apptree_init(&n_master, "Simple Waveform Generator v0.1", &keys, &read) ||
+			apptree_create_node(&n_waveform, n_master, "Waveform", "Change output waveform", NULL) ||
+			apptree_create_node(&n_frequency, n_master, "Frequency", "Change output frequency", &change_frequency) ||
+			apptree_create_node(&n_amplitude, n_master, "Amplitude", "Change output amplitude", &change_amplitude) ||
+			apptree_create_node(&n_duty, n_master, "Duty", "Change square wave duty cycle", &change_duty) ||
+			apptree_create_node(&n_speed, n_master, "Speed", "Trade samples for frequency", &change_speed) ||
+			apptree_create_node(&n_status, n_master, "Status", "View system status", &print_status) ||
+			apptree_create_node(&n_upload, n_master, "Upload", "Upload an arbitrary waveform", &upload_waveform) ||
+			apptree_create_node(&n_harmonics, n_master, "Harmonics", "Build a waveform from harmonics", &set_harmonics) ||
+			apptree_create_node(&n_sweep, n_master, "Sweep", "Sweep the output frequency", &sweep_frequency) ||
+			apptree_create_node(&n_modulate, n_master, "Modulate", "AM or FM modulate the output", &modulate_output) ||
+			apptree_create_node(&n_burst, n_master, "Burst", "Play triggered bursts of cycles", &burst_output) ||
+			apptree_create_node(&n_stream, n_master, "Stream", "Play samples streamed over serial", &stream_waveform) ||
+			apptree_create_node(&n_keying, n_master, "Keying", "FSK, BPSK or OOK keyed over serial", &key_waveform) ||
+			apptree_create_node(&n_builtin, n_master, "Builtin", "DAC triangle or noise generator", &builtin_wave) ||
+			apptree_create_node(&n_runs, n_master, "Runs", "Play levels held for set times", &run_length) ||
+			apptree_create_node(&n_sequence, n_master, "Sequence", "Play a list of timed segments", &run_sequence) ||
+			apptree_create_node(&n_sine, n_waveform, "Sine", "Change to sine wave", &change_waveform) ||
+			apptree_create_node(&n_square, n_waveform, "Sawtooth", "Change to square wave", &change_waveform) ||
+			apptree_create_node(&n_triangle, n_waveform, "Triangle", "Change to triangle wave", &change_waveform) ||
+			apptree_create_node(&n_sawtooth, n_waveform, "Square", "Change to sawtooth wave", &change_waveform)) {
+		printf("Error! Not enough heap for the menu\r\n");
+		while (1);
+	}
 	
 	apptree_enable();
 
@@ -340,5 +962,6 @@ int main (void)
 			GenerateWaveform(settings.wave, settings.frequency, settings.amplitude);
 			settings.changed=false;
 		}
+		precompute_waveform(n_waveform);
 	}
 }
@@ -0,0 +1,166 @@
+/* Host check of the accumulated sawtooth and triangle tables against the
+ * per-sample divide they replaced. Every NoOfSample from 2 to
+ * MAX_MEMORY_ALLOWED is generated at every amplitude code:
+ *	sawtooth: pTable[i] == A*i/N, bit for bit
+ *	triangle: pTable[i] == 2*A*min(i,N-i)/N, odd N included
+ * and no entry may keep the fill pattern written before. Then both
+ * versions are timed. Build and run from the repository root:
+ *
+ *	cc -O2 -std=c99 -Itools/host -I. tools/bench_ramp.c -o bench_ramp
+ *	./bench_ramp
+ *
+ * The check takes about a minute and exits with 1 on the first mismatch.
+ * The host divides in hardware, the Cortex-M0 has no divide instruction
+ * and gains far more than printed. */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <time.h>
+
+#include "WaveShape.c"
+
+//not needed for the ramps, WaveUpload.c is not built here
+void GenerateArbitraryTable(sample_t* pTable, uint32_t NoOfSample, uint32_t Amplitude_In_Resolution)
+{
+	(void)pTable;
+	(void)NoOfSample;
+	(void)Amplitude_In_Resolution;
+}
+
+#define MAX_CODE				(DAC_RESOLUTION-1)
+//above any 12 bit code, shows entries the generator left alone
+#define FILL_PATTERN			0xFFFF
+#define TIMING_ROUNDS			200
+
+static sample_t NewTable[MAX_MEMORY_ALLOWED];
+static sample_t OldTable[MAX_MEMORY_ALLOWED];
+
+//the table generators before the accumulated versions
+static void OldSawToothTable(sample_t* pTable, uint32_t NoOfSample, uint32_t Amplitude_In_Resolution)
+{
+	uint32_t i;
+
+	for(i=0;i<NoOfSample;i++)
+	{
+		pTable[i]=(sample_t)(Amplitude_In_Resolution*i/NoOfSample);
+	}
+}
+
+static void OldTriangularTable(sample_t* pTable, uint32_t NoOfSample, uint32_t Amplitude_In_Resolution)
+{
+	uint32_t i;
+
+	for(i=0;i<NoOfSample/2;i++)
+	{
+		pTable[i]=(sample_t)(2*(Amplitude_In_Resolution*i/NoOfSample));
+	}
+
+	for(i=0;i<NoOfSample/2;i++)
+	{
+		pTable[i+NoOfSample/2]=(sample_t)(Amplitude_In_Resolution-(2*(Amplitude_In_Resolution*i/NoOfSample)));
+	}
+}
+
+static double Seconds(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC,&now);
+	return now.tv_sec+now.tv_nsec*1e-9;
+}
+
+static void Fill(sample_t* pTable, uint32_t NoOfSample)
+{
+	uint32_t i;
+
+	for(i=0;i<NoOfSample;i++)
+		pTable[i] = FILL_PATTERN;
+}
+
+static int CheckRamps(void)
+{
+	uint32_t n;
+	uint32_t a;
+	uint32_t i;
+	uint32_t expect;
+
+	for(n=2;n<=MAX_MEMORY_ALLOWED;n++)
+	{
+		for(a=0;a<=MAX_CODE;a++)
+		{
+			Fill(NewTable,n);
+			GenerateSawToothTable(NewTable,n,a);
+			for(i=0;i<n;i++)
+			{
+				expect = a*i/n;
+				if(NewTable[i]!=expect)
+				{
+					printf("sawtooth N %u A %u [%u]: %u, expected %u\n",n,a,i,NewTable[i],expect);
+					return 0;
+				}
+			}
+
+			Fill(NewTable,n);
+			GenerateTriangularTable(NewTable,n,a);
+			for(i=0;i<n;i++)
+			{
+				expect = 2*a*((i<n-i)?i:n-i)/n;
+				if(NewTable[i]!=expect)
+				{
+					printf("triangle N %u A %u [%u]: %u, expected %u\n",n,a,i,NewTable[i],expect);
+					return 0;
+				}
+			}
+		}
+	}
+
+	printf("NoOfSample 2..%d, amplitude 0..%d\n",MAX_MEMORY_ALLOWED,MAX_CODE);
+	printf("  sawtooth matches A*i/N, triangle matches 2*A*min(i,N-i)/N\n");
+	printf("  every entry written, odd N included\n");
+	return 1;
+}
+
+static double TimeTable(void (*generate)(sample_t*, uint32_t, uint32_t), sample_t* pTable, uint32_t NoOfSample)
+{
+	double start;
+	uint32_t r;
+
+	start = Seconds();
+	for(r=0;r<TIMING_ROUNDS;r++)
+		generate(pTable,NoOfSample,MAX_CODE-(r&1));
+	return (Seconds()-start)/TIMING_ROUNDS;
+}
+
+static void Benchmark(void)
+{
+	static const uint32_t Sizes[] = {50, 200, 1000, MAX_MEMORY_ALLOWED};
+	double old_time;
+	double new_time;
+	uint32_t s;
+
+	printf("time per table near amplitude %d\n",MAX_CODE);
+	for(s=0;s<sizeof(Sizes)/sizeof(Sizes[0]);s++)
+	{
+		old_time = TimeTable(&OldSawToothTable,OldTable,Sizes[s]);
+		new_time = TimeTable(&GenerateSawToothTable,NewTable,Sizes[s]);
+		printf("  sawtooth %4u samples  divide %8.2f us  accumulate %8.2f us  %5.1fx\n",
+			Sizes[s],old_time*1e6,new_time*1e6,old_time/new_time);
+
+		old_time = TimeTable(&OldTriangularTable,OldTable,Sizes[s]);
+		new_time = TimeTable(&GenerateTriangularTable,NewTable,Sizes[s]);
+		printf("  triangle %4u samples  divide %8.2f us  accumulate %8.2f us  %5.1fx\n",
+			Sizes[s],old_time*1e6,new_time*1e6,old_time/new_time);
+	}
+}
+
+int main(void)
+{
+	int ok;
+
+	ok = CheckRamps();
+	Benchmark();
+
+	printf("%s\n",ok?"PASS":"FAIL");
+	return ok?0:1;
+}
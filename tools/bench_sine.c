@@ -0,0 +1,138 @@
+/* Host check of the fixed-point sine table against the double-precision
+ * sin() it replaced. Every NoOfSample from 2 to MAX_MEMORY_ALLOWED is
+ * generated at every amplitude code and compared sample by sample, then
+ * both versions are timed. Build and run from the repository root:
+ *
+ *	cc -O2 -std=c99 -Itools/host -I. tools/bench_sine.c -lm -o bench_sine
+ *	./bench_sine
+ *
+ * The check takes about a minute. Exits with 1 if a sample is more than
+ * 1 LSB off or above the amplitude. A host FPU makes sin() cheap, on the
+ * Cortex-M0 it is soft-float and the gap is far wider than printed here. */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <math.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "WaveShape.c"
+
+//not needed for the sine, WaveUpload.c is not built here
+void GenerateArbitraryTable(sample_t* pTable, uint32_t NoOfSample, uint32_t Amplitude_In_Resolution)
+{
+	(void)pTable;
+	(void)NoOfSample;
+	(void)Amplitude_In_Resolution;
+}
+
+#define MAX_CODE				(DAC_RESOLUTION-1)
+#define TIMING_ROUNDS			20
+
+static sample_t NewTable[MAX_MEMORY_ALLOWED];
+static sample_t OldTable[MAX_MEMORY_ALLOWED];
+
+//the table generator before the fixed-point version
+static void OldSineTable(sample_t* pTable, uint32_t NoOfSample, uint32_t Amplitude_In_Resolution)
+{
+	uint32_t i;
+
+	for(i=0;i<NoOfSample;i++)
+	{
+		pTable[i]=(sample_t)((sin(i*2*PI_VALUE/NoOfSample)+1)*(Amplitude_In_Resolution+1)/2);
+	}
+}
+
+static double Seconds(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC,&now);
+	return now.tv_sec+now.tv_nsec*1e-9;
+}
+
+static int CheckAccuracy(void)
+{
+	static double Sine[MAX_MEMORY_ALLOWED];
+	uint32_t n;
+	uint32_t a;
+	uint32_t i;
+	uint32_t old;
+	int32_t diff;
+	int32_t worst;
+	uint32_t over;
+	uint32_t off;
+
+	worst = 0;
+	over = 0;
+	off = 0;
+	for(n=2;n<=MAX_MEMORY_ALLOWED;n++)
+	{
+		//the reference only depends on the amplitude through one multiply
+		for(i=0;i<n;i++)
+			Sine[i] = sin(i*2*PI_VALUE/n)+1;
+
+		for(a=0;a<=MAX_CODE;a++)
+		{
+			GenerateSineTable(NewTable,n,a);
+			for(i=0;i<n;i++)
+			{
+				old = (uint32_t)(Sine[i]*(a+1)/2);
+				diff = (int32_t)NewTable[i]-(int32_t)old;
+				if(diff<0)
+					diff = -diff;
+				if(diff>worst)
+					worst = diff;
+				if(diff>1)
+					off++;
+				if(NewTable[i]>a)
+					over++;
+			}
+		}
+	}
+
+	printf("NoOfSample 2..%d, amplitude 0..%d\n",MAX_MEMORY_ALLOWED,MAX_CODE);
+	printf("  largest difference   %d LSB\n",worst);
+	printf("  samples over 1 LSB   %u\n",off);
+	printf("  samples above amp    %u\n",over);
+
+	return worst<=1&&over==0;
+}
+
+static void Benchmark(void)
+{
+	static const uint32_t Sizes[] = {50, 200, 1000, MAX_MEMORY_ALLOWED};
+	double start;
+	double old_time;
+	double new_time;
+	uint32_t s;
+	uint32_t r;
+
+	printf("time per table at amplitude %d\n",MAX_CODE);
+	for(s=0;s<sizeof(Sizes)/sizeof(Sizes[0]);s++)
+	{
+		start = Seconds();
+		for(r=0;r<TIMING_ROUNDS;r++)
+			OldSineTable(OldTable,Sizes[s],MAX_CODE);
+		old_time = (Seconds()-start)/TIMING_ROUNDS;
+
+		start = Seconds();
+		for(r=0;r<TIMING_ROUNDS;r++)
+			GenerateSineTable(NewTable,Sizes[s],MAX_CODE);
+		new_time = (Seconds()-start)/TIMING_ROUNDS;
+
+		printf("  %4u samples  sin() %9.2f us  fixed %9.2f us  %6.1fx\n",
+			Sizes[s],old_time*1e6,new_time*1e6,old_time/new_time);
+	}
+}
+
+int main(void)
+{
+	int ok;
+
+	ok = CheckAccuracy();
+	Benchmark();
+
+	printf("%s\n",ok?"PASS":"FAIL");
+	return ok?0:1;
+}
@@ -0,0 +1,204 @@
+#!/usr/bin/env python3
+"""Generates WaveTables.c and WaveTables.h, the flash resident standard
+wavetables played directly by the DMA.
+
+The tables hold full scale 12 bit DAC codes wrapped in TO_SAMPLE() so they
+follow WAVEGEN_SAMPLE_BITS. Every value is computed exactly as the runtime
+generators in WaveShape.c compute it, so a flash table and a generated table
+for the same parameters are identical.
+
+The band-limited sawtooth and square tables have no runtime counterpart.
+Level k sums the harmonics up to BANDLIMIT_MAX_HARMONIC >> k and is
+stretched to full scale, the DDS engine picks the level per octave.
+
+Run from the project directory after changing any of the settings below:
+
+    python tools/gen_wavetables.py
+"""
+
+import math
+import os
+
+MIN_BITS = 6
+MAX_BITS = 10
+AMPLITUDE = 4095
+SINE_QUARTER_BITS = 8
+
+BANDLIMIT_BITS = 10
+BANDLIMIT_MAX_HARMONIC = 256
+BANDLIMIT_LEVELS = 5
+
+SHAPES = (
+    ("WAVEFORM_TYPE_SINE", "Sine"),
+    ("WAVEFORM_TYPE_SAWTOOTH", "SawTooth"),
+    ("WAVEFORM_TYPE_TRIANGULAR", "Triangular"),
+)
+
+OUT_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), os.pardir)
+
+
+def sine_quarter():
+    steps = 1 << SINE_QUARTER_BITS
+    return [int(round(math.sin(i * math.pi / 2 / steps) * 32767))
+            for i in range(steps + 1)]
+
+
+QUARTER = sine_quarter()
+
+
+def sine_q15(phase):
+    """Mirror of SineQ15() in WaveShape.c."""
+    steps = 1 << SINE_QUARTER_BITS
+    quadrant = phase >> 30
+    pos = (phase >> (30 - SINE_QUARTER_BITS - 16)) & ((steps << 16) - 1)
+    if quadrant & 1:
+        pos = (steps << 16) - pos
+    idx = pos >> 16
+    frac = pos & 0xFFFF
+    value = QUARTER[idx]
+    if frac:
+        # arithmetic shift of a non-negative product
+        value += ((QUARTER[idx + 1] - value) * frac) >> 16
+    return -value if quadrant & 2 else value
+
+
+def sine_table(n, a):
+    step = ((1 << 32) + n // 2) // n
+    phase = 0
+    out = []
+    for _ in range(n):
+        out.append(((sine_q15(phase) + 32768) * (a + 1)) >> 16)
+        phase = (phase + step) & 0xFFFFFFFF
+    return out
+
+
+def sawtooth_table(n, a):
+    return [a * i // n for i in range(n)]
+
+
+def triangular_table(n, a):
+    return [2 * a * min(i, n - i) // n for i in range(n)]
+
+
+def band_limited_table(n, a, harmonics, partial):
+    values = []
+    for i in range(n):
+        t = 2 * math.pi * i / n
+        values.append(sum(partial(k) * math.sin(k * t)
+                          for k in range(1, harmonics + 1)))
+    lo = min(values)
+    hi = max(values)
+    return [int(round((v - lo) * a / (hi - lo))) for v in values]
+
+
+def sawtooth_partial(k):
+    # rises from the bottom at the start of the cycle like sawtooth_table
+    return -1.0 / k
+
+
+def square_partial(k):
+    # low for the first half like the two sample square
+    return -1.0 / k if k % 2 else 0.0
+
+
+BANDLIMITED = (
+    ("SawTooth", sawtooth_partial),
+    ("Square", square_partial),
+)
+
+GENERATORS = {
+    "Sine": sine_table,
+    "SawTooth": sawtooth_table,
+    "Triangular": triangular_table,
+}
+
+
+def format_table(name, values):
+    lines = ["static const sample_t %s[%d] =" % (name, len(values)), "{"]
+    for i in range(0, len(values), 8):
+        row = ", ".join("S(%d)" % v for v in values[i:i + 8])
+        lines.append("\t" + row + ("," if i + 8 < len(values) else ""))
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def write_header():
+    text = """/* Generated by tools/gen_wavetables.py, do not edit */
+
+#ifndef WAVETABLES_H
+#define WAVETABLES_H
+
+#define FLASH_TABLE_MIN_BITS		%d
+#define FLASH_TABLE_MAX_BITS		%d
+#define FLASH_TABLE_AMPLITUDE		%d
+#define FLASH_TABLE_SHAPES			%d
+
+/* Band-limited sawtooth and square, level k holds the harmonics up to
+ * FLASH_BANDLIMIT_MAX_HARMONIC>>k */
+#define FLASH_BANDLIMIT_BITS		%d
+#define FLASH_BANDLIMIT_MAX_HARMONIC	%du
+#define FLASH_BANDLIMIT_LEVELS		%d
+#define FLASH_BANDLIMIT_SHAPES		%d
+
+#endif
+""" % (MIN_BITS, MAX_BITS, AMPLITUDE, len(SHAPES), BANDLIMIT_BITS,
+       BANDLIMIT_MAX_HARMONIC, BANDLIMIT_LEVELS, len(BANDLIMITED))
+    with open(os.path.join(OUT_DIR, "WaveTables.h"), "w", newline="\n") as f:
+        f.write(text)
+
+
+def write_source():
+    parts = ["/* Generated by tools/gen_wavetables.py, do not edit */",
+             "",
+             '#include "WaveGenPriv.h"',
+             "",
+             "#define S(code)\t\tTO_SAMPLE(code)",
+             ""]
+    for _, name in SHAPES:
+        for bits in range(MIN_BITS, MAX_BITS + 1):
+            n = 1 << bits
+            parts.append(format_table("%s%d" % (name, n),
+                                      GENERATORS[name](n, AMPLITUDE)))
+            parts.append("")
+
+    parts.append("//indexed by waveform type, then by length bits - FLASH_TABLE_MIN_BITS")
+    parts.append("const sample_t* const FlashTables[FLASH_TABLE_SHAPES]"
+                 "[FLASH_TABLE_MAX_BITS-FLASH_TABLE_MIN_BITS+1] =")
+    parts.append("{")
+    rows = []
+    for enum, name in SHAPES:
+        names = ", ".join("%s%d" % (name, 1 << b)
+                          for b in range(MIN_BITS, MAX_BITS + 1))
+        rows.append("\t{%s}" % names)
+    parts.append(",\n".join(rows))
+    parts.append("};")
+    parts.append("")
+
+    n = 1 << BANDLIMIT_BITS
+    for name, partial in BANDLIMITED:
+        for level in range(BANDLIMIT_LEVELS):
+            harmonics = BANDLIMIT_MAX_HARMONIC >> level
+            parts.append(format_table("%sBand%d" % (name, harmonics),
+                                      band_limited_table(n, AMPLITUDE,
+                                                         harmonics, partial)))
+            parts.append("")
+
+    parts.append("//sawtooth then square, indexed by level")
+    parts.append("const sample_t* const BandLimitTables[FLASH_BANDLIMIT_SHAPES]"
+                 "[FLASH_BANDLIMIT_LEVELS] =")
+    parts.append("{")
+    rows = []
+    for name, _ in BANDLIMITED:
+        names = ", ".join("%sBand%d" % (name, BANDLIMIT_MAX_HARMONIC >> level)
+                          for level in range(BANDLIMIT_LEVELS))
+        rows.append("\t{%s}" % names)
+    parts.append(",\n".join(rows))
+    parts.append("};")
+    parts.append("")
+    with open(os.path.join(OUT_DIR, "WaveTables.c"), "w", newline="\n") as f:
+        f.write("\n".join(parts))
+
+
+if __name__ == "__main__":
+    write_header()
+    write_source()
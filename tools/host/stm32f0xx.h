@@ -0,0 +1,16 @@
+/* Stands in for the device header when table code is built on a host
+ * by the tools/bench_*.c programs. Only the types the driver headers
+ * name are declared, nothing here can reach a register. */
+
+#ifndef STM32F0XX_H
+#define STM32F0XX_H
+
+#include <stdint.h>
+
+typedef struct DAC_TypeDef DAC_TypeDef;
+typedef struct DMA_TypeDef DMA_TypeDef;
+typedef struct DMA_Channel_TypeDef DMA_Channel_TypeDef;
+typedef struct TIM_TypeDef TIM_TypeDef;
+typedef struct GPIO_TypeDef GPIO_TypeDef;
+
+#endif
@@ -0,0 +1,57 @@
+#!/usr/bin/env python3
+"""Sends a bitstream to the generator's keying mode over its serial port.
+
+Select "Keying" in the menu and enter the keying, symbol rate and
+carriers first, then run
+
+    python tools/key_bitstream.py COM3 bits.bin
+
+Every byte of bits.bin is eight symbols, most significant bit first. The
+generator answers every byte it takes with the fill level of its receive
+buffer in percent. One byte is sent back per level byte, one more when the
+level is low and none when it is high, which keeps the level around the
+middle. Needs pyserial.
+"""
+
+import sys
+
+import serial
+
+PREFILL = 16
+LOW_LEVEL = 25
+HIGH_LEVEL = 75
+
+
+def main():
+    if len(sys.argv) != 3:
+        print(__doc__)
+        return 1
+
+    with open(sys.argv[2], "rb") as f:
+        data = list(f.read())
+
+    lowest = 100
+    count = len(data)
+
+    with serial.Serial(sys.argv[1], 115200, timeout=1) as port:
+        port.write(bytes(data[:PREFILL]))
+        del data[:PREFILL]
+
+        while data:
+            reply = port.read(1)
+            if not reply:
+                print("generator stopped answering")
+                return 1
+            level = reply[0]
+            lowest = min(lowest, level)
+            if level < HIGH_LEVEL:
+                port.write(bytes([data.pop(0)]))
+            if level < LOW_LEVEL and data:
+                port.write(bytes([data.pop(0)]))
+
+    print("sent %d symbols, lowest buffer level %d%%" % (count * 8, lowest))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
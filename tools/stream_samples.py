@@ -0,0 +1,61 @@
+#!/usr/bin/env python3
+"""Streams a raw capture to the generator over its serial port.
+
+Select "Stream" in the menu and enter the sample rate first, then run
+
+    python tools/stream_samples.py COM3 capture.raw
+
+capture.raw holds unsigned 16 bit little endian samples, only the top 12
+bits reach the DAC. The generator answers every half buffer it played
+with the fill level of its receive buffer in percent. One half buffer is
+sent back per level byte, one more when the level is low and none when it
+is high, which keeps the level around the middle. Needs pyserial.
+"""
+
+import sys
+
+import serial
+
+HALF_BUFFER = 64
+BYTES_PER_SAMPLE = 2
+LOW_LEVEL = 25
+HIGH_LEVEL = 75
+
+
+def main():
+    if len(sys.argv) != 3:
+        print(__doc__)
+        return 1
+
+    with open(sys.argv[2], "rb") as f:
+        data = f.read()
+
+    chunk = HALF_BUFFER * BYTES_PER_SAMPLE
+    chunks = [data[i:i + chunk] for i in range(0, len(data), chunk)]
+    lowest = 100
+
+    with serial.Serial(sys.argv[1], 115200, timeout=1) as port:
+        # prefill both halves of the playing buffer and one more
+        for _ in range(3):
+            if chunks:
+                port.write(chunks.pop(0))
+
+        while chunks:
+            reply = port.read(1)
+            if not reply:
+                print("generator stopped answering")
+                return 1
+            level = reply[0]
+            lowest = min(lowest, level)
+            if level < HIGH_LEVEL:
+                port.write(chunks.pop(0))
+            if level < LOW_LEVEL and chunks:
+                port.write(chunks.pop(0))
+
+    print("sent %d samples, lowest buffer level %d%%"
+          % (len(data) // BYTES_PER_SAMPLE, lowest))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+"""Uploads an arbitrary waveform to the generator over its serial port.
+
+Select "Upload" in the menu first, then run
+
+    python tools/upload_waveform.py COM3 shape.txt
+
+shape.txt holds one cycle as whitespace separated 12 bit codes (0..4095),
+at most 512 of them. The framing is described in WaveUpload.c. Needs
+pyserial.
+"""
+
+import sys
+
+import serial
+
+SYNC = 0xA5
+ACK = 0x06
+NAK = 0x15
+MAX_SAMPLES = 512
+MAX_PAYLOAD = 255
+RETRIES = 5
+
+
+def fletcher16(data):
+    sum1 = 0
+    sum2 = 0
+    for b in data:
+        sum1 = (sum1 + b) % 255
+        sum2 = (sum2 + sum1) % 255
+    return bytes((sum1, sum2))
+
+
+def frame(kind, payload):
+    body = bytes((ord(kind), len(payload))) + bytes(payload)
+    return bytes((SYNC,)) + body + fletcher16(body)
+
+
+def varint(value):
+    out = bytearray()
+    while True:
+        byte = value & 0x7F
+        value >>= 7
+        if value:
+            out.append(byte | 0x80)
+        else:
+            out.append(byte)
+            return bytes(out)
+
+
+def encode(samples):
+    """Splits the zigzag varint deltas into data frame payloads."""
+    payloads = []
+    payload = bytearray()
+    previous = 0
+    for sample in samples:
+        delta = sample - previous
+        code = varint(delta << 1 if delta >= 0 else (-delta << 1) - 1)
+        if len(payload) + len(code) > MAX_PAYLOAD - 1:
+            payloads.append(payload)
+            payload = bytearray()
+        payload += code
+        previous = sample
+    if payload:
+        payloads.append(payload)
+    return payloads
+
+
+def send(port, data):
+    for _ in range(RETRIES):
+        port.write(data)
+        reply = port.read(1)
+        if reply == bytes((ACK,)):
+            return
+    raise RuntimeError("no ACK after %d tries" % RETRIES)
+
+
+def upload(port, samples):
+    send(port, frame('H', (len(samples) & 0xFF, len(samples) >> 8)))
+    for sequence, payload in enumerate(encode(samples)):
+        send(port, frame('D', bytes((sequence & 0xFF,)) + payload))
+    words = b"".join(s.to_bytes(2, "little") for s in samples)
+    send(port, frame('E', fletcher16(words)))
+
+
+def main():
+    if len(sys.argv) != 3:
+        print(__doc__)
+        return 1
+
+    with open(sys.argv[2]) as f:
+        samples = [int(v) for v in f.read().split()]
+    if not 2 <= len(samples) <= MAX_SAMPLES or not all(0 <= s <= 4095 for s in samples):
+        print("need 2 to %d codes between 0 and 4095" % MAX_SAMPLES)
+        return 1
+
+    with serial.Serial(sys.argv[1], 115200, timeout=1) as port:
+        upload(port, samples)
+    print("uploaded %d samples" % len(samples))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())